@@ -0,0 +1,188 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+volatile std::size_t gSink = 0;
+
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+void DoNotOptimize(std::size_t value)
+{
+	gSink = gSink + value;
+}
+
+//-----------------------------------------------------------------------------
+BenchmarkRunner::BenchmarkRunner(const Options& options)
+	: mOptions(options)
+{
+}
+
+//-----------------------------------------------------------------------------
+void BenchmarkRunner::Add(const std::string& name, std::function<void()> body, std::size_t itemsPerRun)
+{
+	mEntries.push_back(Entry{ name, std::move(body), itemsPerRun });
+}
+
+//-----------------------------------------------------------------------------
+void BenchmarkRunner::Run()
+{
+	mResults.clear();
+	for (const Entry& entry : mEntries) {
+		if (!mOptions.filter.empty() && entry.name.find(mOptions.filter) == std::string::npos) {
+			continue;
+		}
+		BenchmarkResult result = Measure(entry);
+		mResults.push_back(result);
+		std::cout << std::left << std::setw(48) << result.name << std::right
+			<< std::fixed << std::setprecision(4) << std::setw(12) << result.medianMs << " ms" << std::endl;
+	}
+}
+
+//-----------------------------------------------------------------------------
+BenchmarkResult BenchmarkRunner::Measure(const Entry& entry) const
+{
+	// 워밍업. 캐시, 할당기, 분기 예측기를 데운다.
+	for (int i = 0; i < mOptions.warmupRepetitions; ++i) {
+		entry.body();
+	}
+
+	// 한 번의 측정이 최소 시간 이상 걸리도록 반복 횟수를 정한다. (타이머 해상도 영향 줄이기)
+	int iterations = 1;
+	while (true) {
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i) {
+			entry.body();
+		}
+		double elapsed = ElapsedMs(start);
+		if (elapsed >= mOptions.minRepetitionMs || iterations >= (1 << 24)) {
+			break;
+		}
+		// 다음 시도 때 목표 시간을 조금 넘기도록 늘린다.
+		double scale = (elapsed > 0.0) ? (mOptions.minRepetitionMs * 1.2 / elapsed) : 10.0;
+		iterations = static_cast<int>(std::min(static_cast<double>(iterations) * std::max(scale, 2.0), static_cast<double>(1 << 24)));
+	}
+
+	std::vector<double> samples{};
+	samples.reserve(mOptions.repetitions);
+	for (int repetition = 0; repetition < mOptions.repetitions; ++repetition) {
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; ++i) {
+			entry.body();
+		}
+		samples.push_back(ElapsedMs(start) / iterations);
+	}
+	std::sort(samples.begin(), samples.end());
+
+	BenchmarkResult result{};
+	result.name = entry.name;
+	result.repetitions = static_cast<int>(samples.size());
+	result.iterationsPerRepetition = iterations;
+	if (samples.empty()) {
+		return result;
+	}
+
+	double sum = 0.0;
+	for (double sample : samples) {
+		sum += sample;
+	}
+	result.meanMs = sum / samples.size();
+
+	double variance = 0.0;
+	for (double sample : samples) {
+		variance += (sample - result.meanMs) * (sample - result.meanMs);
+	}
+	result.stddevMs = std::sqrt(variance / samples.size());
+
+	result.minMs = samples.front();
+	result.maxMs = samples.back();
+	result.medianMs = samples[samples.size() / 2];
+	result.p95Ms = samples[std::min(samples.size() - 1, static_cast<std::size_t>(std::ceil(samples.size() * 0.95)) - 1)];
+	result.itemsPerSecond = (result.medianMs > 0.0) ? entry.itemsPerRun / (result.medianMs / 1000.0) : 0.0;
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+void BenchmarkRunner::PrintTable(std::ostream& os) const
+{
+	os << std::left << std::setw(48) << "benchmark" << std::right
+		<< std::setw(12) << "median ms" << std::setw(12) << "mean ms" << std::setw(12) << "stddev"
+		<< std::setw(12) << "p95 ms" << std::setw(14) << "items/s" << std::endl;
+	os << std::fixed;
+	for (const BenchmarkResult& result : mResults) {
+		os << std::left << std::setw(48) << result.name << std::right << std::setprecision(4)
+			<< std::setw(12) << result.medianMs
+			<< std::setw(12) << result.meanMs
+			<< std::setw(12) << result.stddevMs
+			<< std::setw(12) << result.p95Ms
+			<< std::setprecision(0) << std::setw(14) << result.itemsPerSecond << std::endl;
+	}
+	os << std::defaultfloat;
+}
+
+//-----------------------------------------------------------------------------
+bool BenchmarkRunner::WriteJson(const std::string& path) const
+{
+	std::ofstream file(path);
+	if (!file) {
+		std::cerr << "[Benchmark] failed to open " << path << std::endl;
+		return false;
+	}
+
+	file << std::fixed << std::setprecision(6);
+	file << "{\n  \"benchmarks\": [\n";
+	for (std::size_t i = 0; i < mResults.size(); ++i) {
+		const BenchmarkResult& result = mResults[i];
+		file << "    { \"name\": \"" << result.name << "\""
+			<< ", \"repetitions\": " << result.repetitions
+			<< ", \"iterations\": " << result.iterationsPerRepetition
+			<< ", \"min_ms\": " << result.minMs
+			<< ", \"mean_ms\": " << result.meanMs
+			<< ", \"median_ms\": " << result.medianMs
+			<< ", \"p95_ms\": " << result.p95Ms
+			<< ", \"max_ms\": " << result.maxMs
+			<< ", \"stddev_ms\": " << result.stddevMs
+			<< ", \"items_per_second\": " << result.itemsPerSecond
+			<< " }" << ((i + 1 < mResults.size()) ? ",\n" : "\n");
+	}
+	file << "  ]\n}\n";
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool BenchmarkRunner::WriteCsv(const std::string& path) const
+{
+	std::ofstream file(path);
+	if (!file) {
+		std::cerr << "[Benchmark] failed to open " << path << std::endl;
+		return false;
+	}
+
+	file << "name,repetitions,iterations,min_ms,mean_ms,median_ms,p95_ms,max_ms,stddev_ms,items_per_second\n";
+	file << std::fixed << std::setprecision(6);
+	for (const BenchmarkResult& result : mResults) {
+		file << result.name << ','
+			<< result.repetitions << ','
+			<< result.iterationsPerRepetition << ','
+			<< result.minMs << ','
+			<< result.meanMs << ','
+			<< result.medianMs << ','
+			<< result.p95Ms << ','
+			<< result.maxMs << ','
+			<< result.stddevMs << ','
+			<< result.itemsPerSecond << '\n';
+	}
+	return true;
+}
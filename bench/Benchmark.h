@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// 벤치마크 하나의 측정 결과. 시간은 본문 1회 실행 기준(밀리초).
+struct BenchmarkResult
+{
+	std::string name{};
+	int repetitions{};
+	int iterationsPerRepetition{};
+	double minMs{};
+	double meanMs{};
+	double medianMs{};
+	double p95Ms{};
+	double maxMs{};
+	double stddevMs{};
+	// 본문 1회가 처리하는 항목 수(버텍스, 바이트 등) 기준 초당 처리량.
+	double itemsPerSecond{};
+};
+
+// 간단한 CPU 벤치마크 실행기.
+// 워밍업 후 한 번의 측정(repetition)이 최소 시간 이상 걸리도록 반복 횟수를 맞추고,
+// 측정을 여러 번 해서 min/mean/median/p95/max/표준편차를 낸다.
+class BenchmarkRunner
+{
+public:
+	struct Options
+	{
+		int warmupRepetitions{ 3 };
+		int repetitions{ 20 };
+		double minRepetitionMs{ 10.0 };
+		// 이름에 이 문자열이 들어간 벤치마크만 돌린다.
+		std::string filter{};
+	};
+
+	explicit BenchmarkRunner(const Options& options);
+
+	void Add(const std::string& name, std::function<void()> body, std::size_t itemsPerRun = 1);
+	void Run();
+
+	const std::vector<BenchmarkResult>& GetResults() const { return mResults; }
+	void PrintTable(std::ostream& os) const;
+	bool WriteJson(const std::string& path) const;
+	bool WriteCsv(const std::string& path) const;
+
+private:
+	struct Entry
+	{
+		std::string name{};
+		std::function<void()> body{};
+		std::size_t itemsPerRun{};
+	};
+
+	BenchmarkResult Measure(const Entry& entry) const;
+
+private:
+	Options mOptions{};
+	std::vector<Entry> mEntries{};
+	std::vector<BenchmarkResult> mResults{};
+};
+
+// 컴파일러가 결과를 쓰지 않는 계산을 지워버리지 않도록 값을 흘려보낸다.
+void DoNotOptimize(std::size_t value);
@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtc/matrix_inverse.hpp"
+#include "stb/stb_image.h"
+
+#include "Benchmark.h"
+#include "common/Geometry.h"
+#include "core/CommandLine.h"
+#include "mesh/MeshIndices.h"
+#include "mesh/MeshOptimizer.h"
+#include "mesh/MeshSimplifier.h"
+#include "mesh/ObjLoader.h"
+#include "mesh/VertexQuantizer.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+//-----------------------------------------------------------------------------
+void PrintUsage()
+{
+	std::cout << "Usage: bench [options]\n"
+		<< "  --resources=DIR     resources folder (default: resources or ../resources)\n"
+		<< "  --filter=TEXT       run only benchmarks whose name contains TEXT\n"
+		<< "  --repetitions=N     measured repetitions per benchmark (default 20)\n"
+		<< "  --warmup=N          warmup runs per benchmark (default 3)\n"
+		<< "  --min-time=MS       minimum time of one repetition (default 10)\n"
+		<< "  --json=PATH         write results as JSON\n"
+		<< "  --csv=PATH          write results as CSV\n";
+}
+
+//-----------------------------------------------------------------------------
+std::string FindResourceDirectory(const std::string& requested)
+{
+	if (!requested.empty()) {
+		return requested;
+	}
+	for (const char* candidate : { "resources", "../resources", "../../resources" }) {
+		if (fs::is_directory(candidate)) {
+			return candidate;
+		}
+	}
+	return "resources";
+}
+
+//-----------------------------------------------------------------------------
+bool ReadFile(const fs::path& path, std::vector<char>& data)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		return false;
+	}
+	data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// 예제들이 쓰는 기본 도형 생성.
+void AddGeometryBenchmarks(BenchmarkRunner& runner)
+{
+	runner.Add("geometry/triangle", []() {
+		std::vector<glm::vec3> vertices{};
+		std::vector<unsigned int> indices{};
+		Geometry::CreateTriangle(vertices, indices);
+		DoNotOptimize(vertices.size() + indices.size());
+	});
+	runner.Add("geometry/color_triangle", []() {
+		std::vector<Vertex> vertices{};
+		std::vector<unsigned int> indices{};
+		Geometry::CreateColorTriangle(vertices, indices);
+		DoNotOptimize(vertices.size() + indices.size());
+	});
+	runner.Add("geometry/rectangle", []() {
+		std::vector<VertexUV> vertices{};
+		std::vector<unsigned int> indices{};
+		Geometry::CreateRectangle(UvType::Fit, vertices, indices);
+		DoNotOptimize(vertices.size() + indices.size());
+	});
+}
+
+//-----------------------------------------------------------------------------
+// 이미지 디코딩. 파일 읽기 시간이 섞이지 않도록 미리 메모리에 올려두고 디코딩만 잰다.
+void AddTextureBenchmarks(BenchmarkRunner& runner, const fs::path& resourceDirectory)
+{
+	std::vector<fs::path> images{};
+	for (const auto& item : fs::directory_iterator(resourceDirectory)) {
+		std::string extension = item.path().extension().string();
+		if (item.is_regular_file() && (extension == ".png" || extension == ".jpg")) {
+			images.push_back(item.path());
+		}
+	}
+	std::sort(images.begin(), images.end());
+
+	stbi_set_flip_vertically_on_load(true); // Example04 와 같은 설정.
+	for (const fs::path& path : images) {
+		auto data = std::make_shared<std::vector<char>>();
+		if (!ReadFile(path, *data)) {
+			std::cerr << "[Bench] failed to read " << path.string() << std::endl;
+			continue;
+		}
+		int width = 0, height = 0, channels = 0;
+		if (!stbi_info_from_memory(reinterpret_cast<const stbi_uc*>(data->data()), static_cast<int>(data->size()), &width, &height, &channels)) {
+			continue;
+		}
+		runner.Add("texture/decode/" + path.filename().string(), [data]() {
+			int width = 0, height = 0, channels = 0;
+			stbi_uc* pixels = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(data->data()), static_cast<int>(data->size()), &width, &height, &channels, 0);
+			DoNotOptimize(reinterpret_cast<std::uintptr_t>(pixels));
+			stbi_image_free(pixels);
+		}, static_cast<std::size_t>(width) * height);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// OBJ 파싱. 역시 파일 내용은 미리 읽어둔다.
+void AddMeshBenchmarks(BenchmarkRunner& runner, const fs::path& resourceDirectory)
+{
+	fs::path modelDirectory = resourceDirectory / "models";
+	if (!fs::is_directory(modelDirectory)) {
+		return;
+	}
+
+	std::vector<fs::path> models{};
+	for (const auto& item : fs::recursive_directory_iterator(modelDirectory)) {
+		if (item.is_regular_file() && item.path().extension() == ".obj") {
+			models.push_back(item.path());
+		}
+	}
+	std::sort(models.begin(), models.end());
+
+	for (const fs::path& path : models) {
+		auto text = std::make_shared<std::vector<char>>();
+		if (!ReadFile(path, *text)) {
+			std::cerr << "[Bench] failed to read " << path.string() << std::endl;
+			continue;
+		}
+		runner.Add("mesh/parse_obj/" + path.filename().string(), [text]() {
+			MeshData mesh{};
+			ObjLoader::Parse(text->data(), text->size(), mesh);
+			DoNotOptimize(mesh.vertices.size() + mesh.indices.size());
+		}, text->size());
+
+		auto mesh = std::make_shared<MeshData>();
+		if (ObjLoader::Parse(text->data(), text->size(), *mesh)) {
+			runner.Add("mesh/quantize/" + path.filename().string(), [mesh]() {
+				QuantizedMesh quantized{};
+				VertexQuantizer::Quantize(*mesh, quantized);
+				DoNotOptimize(quantized.vertices.size());
+			}, mesh->vertices.size() * sizeof(ModelVertex));
+
+			runner.Add("mesh/optimize/" + path.filename().string(), [mesh]() {
+				MeshData optimized = *mesh;
+				MeshOptimizer::Optimize(optimized);
+				DoNotOptimize(optimized.indices.size());
+			}, mesh->indices.size() * sizeof(unsigned int));
+
+			runner.Add("mesh/simplify/" + path.filename().string(), [mesh]() {
+				std::vector<MeshLod> lods{};
+				MeshSimplifier::BuildLodChain(*mesh, 5, lods);
+				DoNotOptimize(lods.size());
+			}, mesh->indices.size() * sizeof(unsigned int));
+
+			// 구운 파일(.mesh)의 인덱스 풀기. 처리량은 풀린 인덱스 바이트 기준.
+			auto encoded = std::make_shared<std::vector<std::uint8_t>>();
+			MeshIndices::Encode(mesh->indices.data(), mesh->indices.size(), *encoded);
+			std::size_t indexCount = mesh->indices.size();
+			runner.Add("mesh/decode_indices/" + path.filename().string(), [encoded, indexCount]() {
+				std::vector<unsigned int> indices{};
+				MeshIndices::Decode(encoded->data(), encoded->size(), indexCount, indices);
+				DoNotOptimize(indices.size());
+			}, indexCount * sizeof(unsigned int));
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// 오브젝트 여러 개의 MVP, 노멀 행렬 계산. 렌더 루프에서 매 프레임 하는 일.
+void AddMathBenchmarks(BenchmarkRunner& runner)
+{
+	const std::size_t OBJECT_COUNT = 4096;
+
+	auto models = std::make_shared<std::vector<glm::mat4>>(OBJECT_COUNT);
+	for (std::size_t i = 0; i < OBJECT_COUNT; ++i) {
+		float t = static_cast<float>(i);
+		glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(t * 0.1f, 0.0f, -t * 0.05f));
+		model = glm::rotate(model, t * 0.01f, glm::vec3(0.0f, 1.0f, 0.0f));
+		(*models)[i] = glm::scale(model, glm::vec3(1.0f + 0.001f * t));
+	}
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+	glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 5.0f, 10.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	auto mvps = std::make_shared<std::vector<glm::mat4>>(OBJECT_COUNT);
+	auto normals = std::make_shared<std::vector<glm::mat3>>(OBJECT_COUNT);
+
+	runner.Add("math/mvp_batch_4096", [models, mvps, projection, view]() {
+		glm::mat4 viewProjection = projection * view;
+		for (std::size_t i = 0; i < models->size(); ++i) {
+			(*mvps)[i] = viewProjection * (*models)[i];
+		}
+		DoNotOptimize(static_cast<std::size_t>((*mvps)[models->size() - 1][3][0]));
+	}, OBJECT_COUNT);
+
+	runner.Add("math/normal_matrix_batch_4096", [models, normals]() {
+		for (std::size_t i = 0; i < models->size(); ++i) {
+			(*normals)[i] = glm::inverseTranspose(glm::mat3((*models)[i]));
+		}
+		DoNotOptimize(static_cast<std::size_t>((*normals)[models->size() - 1][0][0]));
+	}, OBJECT_COUNT);
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+	CommandLine args(argc, argv);
+	if (args.Has("help")) {
+		PrintUsage();
+		return 0;
+	}
+
+	BenchmarkRunner::Options options{};
+	options.repetitions = args.GetInt("repetitions", options.repetitions);
+	options.warmupRepetitions = args.GetInt("warmup", options.warmupRepetitions);
+	options.minRepetitionMs = args.GetDouble("min-time", options.minRepetitionMs);
+	options.filter = args.GetString("filter");
+	std::string jsonPath = args.GetString("json");
+	std::string csvPath = args.GetString("csv");
+	fs::path resourceDirectory = FindResourceDirectory(args.GetString("resources"));
+
+	for (const std::string& option : args.GetUnusedOptions()) {
+		std::cerr << "[Bench] unknown option --" << option << std::endl;
+	}
+
+	BenchmarkRunner runner(options);
+	AddGeometryBenchmarks(runner);
+	if (fs::is_directory(resourceDirectory)) {
+		AddTextureBenchmarks(runner, resourceDirectory);
+		AddMeshBenchmarks(runner, resourceDirectory);
+	}
+	else {
+		std::cerr << "[Bench] resources folder not found: " << resourceDirectory.string() << std::endl;
+	}
+	AddMathBenchmarks(runner);
+
+	runner.Run();
+	std::cout << std::endl;
+	runner.PrintTable(std::cout);
+
+	if (!jsonPath.empty()) {
+		runner.WriteJson(jsonPath);
+	}
+	if (!csvPath.empty()) {
+		runner.WriteCsv(csvPath);
+	}
+	return 0;
+}
@@ -1,7 +1,5 @@
 #version 330 core
 
-uniform vec3 customColor;
-
 out vec4 Color;
 
 void main()
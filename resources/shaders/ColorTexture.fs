@@ -4,7 +4,6 @@ in vec2 TextureUV;
 
 out vec4 Color;
 
-uniform vec3 customColor;
 uniform sampler2D sample0;
 
 
@@ -5,8 +5,6 @@ layout(location = 1) in vec3 vertex_color;
 layout(location = 2) in vec3 normal;
 layout(location = 3) in vec2 texture_uv;
 
-uniform mat4 mvp;
-
 out vec2 TextureUV;
 
 void main()
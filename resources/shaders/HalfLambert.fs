@@ -1,10 +1,11 @@
 #version 330 core
 
 in vec3 Normal;
+#ifdef USE_TEXTURE
+in vec2 TextureUV;
 
-uniform vec3 lightDirection;
-uniform vec3 lightColor;
-uniform vec3 customColor;
+uniform sampler2D sample0;
+#endif
 
 out vec4 Color;
 
@@ -13,7 +14,16 @@ void main()
     vec3 normal = normalize(Normal);
     float brightness = max(dot(lightDirection, -normal) * 0.5f + 0.5f, 0);
     brightness = pow(brightness, 2);
-    vec3 diffuse = brightness * lightColor * customColor;
+    vec3 diffuse = brightness * lightColor;
+#ifdef USE_AMBIENT
+    diffuse += ambientIntensity * lightColor;
+#endif
+    diffuse *= customColor;
 
+#ifdef USE_TEXTURE
+    vec4 TextureColor = texture(sample0, TextureUV);
+    Color = vec4(diffuse * TextureColor.rgb, TextureColor.a);
+#else
     Color = vec4(diffuse, 1);
+#endif
 }
\ No newline at end of file
@@ -5,8 +5,6 @@ layout(location = 2) in vec3 inNormal;
 layout(location = 3) in vec2 inTextureUV;
 layout(location = 4) in vec4 inPosition4;
 
-uniform mat4 mvp;
-
 out vec3 color;
 out vec2 TextureUV;
 
@@ -2,12 +2,20 @@
 layout(location = 0) in vec3 position;
 layout(location = 1) in vec3 vertex_color;
 layout(location = 2) in vec3 normal;
+#ifdef USE_TEXTURE
+layout(location = 3) in vec2 texture_uv;
 
-uniform mat4 mvp;
+out vec2 TextureUV;
+#endif
 
 void main()
 {
+#ifdef USE_TEXTURE
+	vec3 expand = normal * 0.01f;
+	TextureUV = texture_uv;
+#else
 	vec3 expand = normal * 0.015f;
+#endif
 	vec3 position2 = position + expand;
 	gl_Position = mvp * vec4(position2, 1.0f);
 }
\ No newline at end of file
@@ -2,11 +2,11 @@
 
 in vec3 Normal;
 in vec4 VertexWorldPosition;
+#ifdef USE_TEXTURE
+in vec2 TextureUV;
 
-uniform vec3 lightDirection;
-uniform vec3 lightColor;
-uniform vec3 customColor;
-uniform vec3 cameraWorldPosition;
+uniform sampler2D sample0;
+#endif
 
 out vec4 Color;
 
@@ -28,9 +28,19 @@ void main()
     rim = pow(rim, 4);
     
     // ׵θ   Ѵ.
+#ifdef USE_TEXTURE
+    vec3 yellow = vec3(1,1,1);
+#else
     vec3 yellow = vec3(1,1,0);
+#endif
     vec3 rimColor = yellow * rim;
 
     //  꿡   ϱ  Ͽ   Ѵ.
     Color = vec4(diffuse + rimColor, 1);
+
+#ifdef USE_TEXTURE
+    // ؽ ÷ Ѵ.
+    vec4 TextureColor = texture(sample0, TextureUV);
+    Color = vec4(Color.rgb * TextureColor.rgb, 1);
+#endif
 }
\ No newline at end of file
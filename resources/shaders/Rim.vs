@@ -2,13 +2,15 @@
 layout(location = 0) in vec3 position;
 layout(location = 1) in vec3 vertex_color;
 layout(location = 2) in vec3 normal;
+#ifdef USE_TEXTURE
+layout(location = 3) in vec2 texture_uv;
+#endif
 
 out vec3 Normal;
 out vec4 VertexWorldPosition;
-
-uniform mat4 mvp;
-uniform mat3 normalMatrix;
-uniform mat4 modelMatrix;
+#ifdef USE_TEXTURE
+out vec2 TextureUV;
+#endif
 
 void main()
 {
@@ -16,4 +18,7 @@ void main()
 	Normal = normalMatrix * normal;
 
 	VertexWorldPosition = modelMatrix * vec4(position, 1.0f);
+#ifdef USE_TEXTURE
+	TextureUV = texture_uv;
+#endif
 }
\ No newline at end of file
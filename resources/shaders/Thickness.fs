@@ -6,10 +6,6 @@ in vec3 Normal;
 in vec3 LightDir;
 
 uniform sampler2D sample0;
-uniform vec3 lightDirection;
-uniform vec3 lightColor;
-uniform float ambientIntensity;
-
 out vec4 Color;
 
 void main()
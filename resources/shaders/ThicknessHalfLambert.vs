@@ -8,8 +8,6 @@ out vec3 VertexColor;
 out vec2 TextureUV;
 out vec3 Normal;
 
-uniform mat4 mvp;
-uniform mat3 normalMatrix;
 uniform float thickness;
 
 void main()
@@ -2,8 +2,6 @@
 
 in vec3 VertexColor;
 
-uniform vec3 customColor;
-
 out vec4 Color;
 
 void main()
@@ -4,8 +4,6 @@ layout(location = 1) in vec3 vertex_color;
 
 out vec3 VertexColor;
 
-uniform mat4 mvp;
-
 void main()
 {
 	gl_Position = mvp * vec4(position, 1.0f);
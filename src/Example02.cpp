@@ -6,6 +6,13 @@
 #include "glad/glad.h"
 #include "GLFW/glfw3.h"
 
+#include "common/Geometry.h"
+#include "core/Profiler.h"
+#include "render/VertexArrayCache.h"
+#include "ExampleRegistry.h"
+
+REGISTER_EXAMPLE("02", Example02, "Triangle");
+
 //-----------------------------------------------------------------------------
 Example02::Example02()
 {
@@ -20,6 +27,7 @@ Example02::~Example02()
 //-----------------------------------------------------------------------------
 void Example02::CreateDefaultShader()
 {
+	PROFILE_SCOPE("Example02::CreateDefaultShader");
 	// 버텍스 셰이더 코드.
 	std::string vertexCode = R"(
 		#version 460 core
@@ -39,145 +47,52 @@ void Example02::CreateDefaultShader()
 		}
 		)";
 
-	const char* vShaderCode = vertexCode.c_str();
-	const char* fShaderCode = fragmentCode.c_str();
-
-	unsigned int vertex, fragment;
-	// 버텍스 셰이더 컴파일
-	vertex = glCreateShader(GL_VERTEX_SHADER);
-	glShaderSource(vertex, 1, &vShaderCode, NULL);
-	glCompileShader(vertex);
-	CheckShaderCompileErrors(vertex, "VERTEX");	// 컴파일 에러 체크
-
-	// 프래그먼트 셰이더 컴파일
-	fragment = glCreateShader(GL_FRAGMENT_SHADER);
-	glShaderSource(fragment, 1, &fShaderCode, NULL);
-	glCompileShader(fragment);
-	CheckShaderCompileErrors(fragment, "FRAGMENT");	// 컴파일 에러 체크
-
-	// 셰이더 프로그램 생성 및 링크
-	mDefaultShaderID = glCreateProgram();
-	glAttachShader(mDefaultShaderID, vertex);
-	glAttachShader(mDefaultShaderID, fragment);
-	glLinkProgram(mDefaultShaderID);
-	CheckShaderCompileErrors(mDefaultShaderID, "PROGRAM");	// 링크 에러 체크
-
-	// 컴파일과 링크(등록)가 끝난 셰이더는 더 이상 필요 없으므로 삭제
-	glDeleteShader(vertex);
-	glDeleteShader(fragment);
-}
-
-//-----------------------------------------------------------------------------
-void Example02::CheckShaderCompileErrors(unsigned int shader, std::string type)
-{
-	GLint success{};
-	GLchar errorLog[1024]{};
-
-	if ("PROGRAM" == type) {
-		glGetProgramiv(shader, GL_LINK_STATUS, &success);
-		if (!success) {
-			glGetProgramInfoLog(shader, 1024, NULL, errorLog);
-			std::cerr << "ERROR::SHADER_PROGRAM_LINKING_ERROR of type: " << type << "\n"
-				<< errorLog << "\n -- --------------------------------------------------- -- " << std::endl;
-		}
-	}
-	else {				
-		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-		if (!success) {
-			glGetShaderInfoLog(shader, 1024, NULL, errorLog);
-			std::cerr << "ERROR::SHADER_COMPILATION_ERROR of type: " << type << "\n"
-				<< errorLog << "\n -- --------------------------------------------------- -- " << std::endl;
-		}
-	}
+	// 같은 소스로 만든 프로그램이 이미 있으면 다시 컴파일하지 않고 그것을 쓴다.
+	mDefaultShader = mShaderCache.GetOrCreate(vertexCode, fragmentCode, "Example02::Default");
 }
 
 //-----------------------------------------------------------------------------
 void Example02::DeleteDefaultShader()
 {
-	glDeleteProgram(mDefaultShaderID);
+	mDefaultShader.reset();
 }
 
 //-----------------------------------------------------------------------------
 void Example02::CreateTriangle()
 {
-	/*
-	*          (0, 1, 0)
-	*          (index:0)
-	*              *
-	*             * *
-	*            *   *
-	*           *     *
-	*          *   +   *
-	*         * (center)*
-	*        *  (0,0,0)  *
-	*       *             *
-	*      *****************
-	* (-1,-1,0)         (1,-1,0)
-	* (index:1)         (index:2)
-	*/
-
-	// 삼각형의 버텍스 좌표들.
-	mVertices.push_back(glm::vec3(0.0f, 1.0f, 0.0f));   // index: 0
-	mVertices.push_back(glm::vec3(-1.0f, -1.0f, 0.0f)); // index: 1
-	mVertices.push_back(glm::vec3(1.0f, -1.0f, 0.0f));  // index: 2
-	// 삼각형의 인덱스 배열.
-	mIndices.push_back(0);
-	mIndices.push_back(1);
-	mIndices.push_back(2);
-
+	Geometry::CreateTriangle(mVertices, mIndices);
 }
 
 //-----------------------------------------------------------------------------
 void Example02::CreateVertexBuffer()
 {
-	// 버텍스 버퍼와 인덱스 버퍼를 보관할 "vertex array" 오브젝트 생성.
-	glGenVertexArrays(1, &mVertexArrayObjectId);
-	// 버텍스 버퍼 생성
-	glGenBuffers(1, &mVertexBufferObjectId);
-	// element(인덱스) 버퍼 생성
-	glGenBuffers(1, &mElementBufferObjectId);
-	
-	// VAO 바인딩.
-	glBindVertexArray(mVertexArrayObjectId);
-	{
-		// VBO 바인딩 및 버텍스 데이터 업로드.
-		glBindBuffer(GL_ARRAY_BUFFER, mVertexBufferObjectId);					
-		glBufferData(GL_ARRAY_BUFFER, mVertices.size() * sizeof(glm::vec3), mVertices.data(), GL_STATIC_DRAW);
-		
-		// EBO에 인덱스 데이터 업로드.
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mElementBufferObjectId);					
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndices.size() * sizeof(unsigned int), mIndices.data(), GL_STATIC_DRAW);
-		
-		// 버텍스 속성 포인터 설정.
-		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
-		glEnableVertexAttribArray(0);
-
-		// 바인딩 해제.
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-		glBindVertexArray(0);
-	}
+	// 버텍스와 element(인덱스) 데이터를 메시 아레나의 glm::vec3 포맷 버퍼에 올린다.
+	// 속성 설정은 그 포맷의 VAO 가 한 번만 한다. (common/Vertex.h 의 VertexLayout)
+	mMeshHandle = mMeshArena.Allocate(mVertices, mIndices);
 }
 
 //-----------------------------------------------------------------------------
 void Example02::Initialize()
 {
+	PROFILE_SCOPE("Example02::Initialize");
 	CreateDefaultShader();
 	CreateTriangle();
 	CreateVertexBuffer();
 }
 
 //-----------------------------------------------------------------------------
-void Example02::Render()
+void Example02::Render(float alpha)
 {
-	// 렌더링에 적용할 셰이더 프로그램 설정.
-	glUseProgram(mDefaultShaderID);
-	// VAO 바인딩.
-	glBindVertexArray(mVertexArrayObjectId);
-	{
-		// 삼각형 렌더링.
-		glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mIndices.size()), GL_UNSIGNED_INT, 0);
+	PROFILE_SCOPE("Example02::Render");
+	GPU_PROFILE_SCOPE(mGpuProfiler, "Example02::DrawTriangle");
+	if (mDefaultShader == nullptr) {
+		return;
 	}
-	glBindVertexArray(0);
+	// 렌더링에 적용할 셰이더 프로그램 설정.
+	mDefaultShader->Use();
+	// 삼각형 렌더링. 포맷의 VAO 에 아레나 버퍼를 붙이고 glDrawElementsBaseVertex 로 그린다.
+	// 다음 프레임도 같은 VAO 를 쓰므로 풀지 않는다.
+	mMeshArena.Draw(mMeshHandle);
 }
 
 //-----------------------------------------------------------------------------
@@ -190,9 +105,7 @@ void Example02::CleanUp()
 //-----------------------------------------------------------------------------
 void Example02::DeleteVertexBuffer()
 {
-	glDeleteVertexArrays(1, &mVertexArrayObjectId);
-	glDeleteBuffers(1, &mVertexBufferObjectId);
-	glDeleteBuffers(1, &mElementBufferObjectId);
+	mMeshArena.Free(mMeshHandle);
 }
 
 //-----------------------------------------------------------------------------
\ No newline at end of file
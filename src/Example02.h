@@ -1,7 +1,9 @@
 #pragma once
 #include "ExampleBase.h"
+#include <memory>
 #include <vector>
 #include "glm/glm.hpp"
+#include "render/ShaderProgram.h"
 
 class Example02 : public ExampleBase
 {
@@ -9,13 +11,12 @@ public:
 	Example02();
 	virtual ~Example02();
 	virtual void Initialize() override;
-	virtual void Render() override;
+	virtual void Render(float alpha) override;
 	virtual void CleanUp() override;
 
 private:
 	// 셰이더 관련.
 	void CreateDefaultShader();
-	void CheckShaderCompileErrors(unsigned int shader, std::string type);
 	void DeleteDefaultShader();
 
 	// 삼각형 렌더링 관련.
@@ -28,12 +29,10 @@ private:
 	std::vector<glm::vec3> mVertices{};
 	std::vector<unsigned int> mIndices{};
 
-	// OpenGL에서 생성한 버퍼 ID를 보관할 변수들.
-	unsigned int mVertexArrayObjectId{};
-	unsigned int mVertexBufferObjectId{};
-	unsigned int mElementBufferObjectId{};
+	// ExampleBase 의 mMeshArena 에 올린 버텍스/인덱스 구간. (버퍼와 VAO 는 포맷별로 공유한다)
+	MeshArena::MeshHandle mMeshHandle{};
 
-	// OpenGL에서 사용하는 셰이더 ID를 보관할 변수.
-	unsigned int mDefaultShaderID{};
+	// 셰이더 캐시에서 받은 프로그램. (같은 소스를 쓰는 곳과 공유한다)
+	std::shared_ptr<ShaderProgram> mDefaultShader{};
 };
 
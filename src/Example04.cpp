@@ -6,13 +6,22 @@
 #include "glad/glad.h"
 #include "GLFW/glfw3.h"
 
-#define STB_IMAGE_IMPLEMENTATION
+#include "core/CommandLine.h"
+#include "core/Profiler.h"
+#include "render/GlState.h"
+#include "ExampleRegistry.h"
+
 #include "stb/stb_image.h"
 
 
+REGISTER_EXAMPLE("04", Example04, "Textured rectangle (--uv, --wrap, --filter)");
+
 Example04::Example04()
 {
 	mTitle = "Example04_Texture";
+	mUvType = UvType::Fit;
+	mWrapType = GL_REPEAT;
+	mFilterType = GL_LINEAR;
 }
 
 Example04::~Example04()
@@ -29,10 +38,51 @@ void Example04::RunWidthParam(UvType uvType, int wrapType, int filterType)
 	ExampleBase::Run();
 }
 
+//---------------------------------------------------------------------------
+// --uv=fit|smaller|bigger, --wrap=repeat|mirror|edge|border, --filter=linear|nearest
+void Example04::Configure(const CommandLine& args)
+{
+	ExampleBase::Configure(args);
+
+	std::string uv = args.GetString("uv", "");
+	if (uv == "fit") {
+		mUvType = UvType::Fit;
+	} else if (uv == "smaller") {
+		mUvType = UvType::Smaller;
+	} else if (uv == "bigger") {
+		mUvType = UvType::Bigger;
+	} else if (!uv.empty()) {
+		std::cout << "Unknown --uv value: " << uv << std::endl;
+	}
+
+	std::string wrap = args.GetString("wrap", "");
+	if (wrap == "repeat") {
+		mWrapType = GL_REPEAT;
+	} else if (wrap == "mirror") {
+		mWrapType = GL_MIRRORED_REPEAT;
+	} else if (wrap == "edge") {
+		mWrapType = GL_CLAMP_TO_EDGE;
+	} else if (wrap == "border") {
+		mWrapType = GL_CLAMP_TO_BORDER;
+	} else if (!wrap.empty()) {
+		std::cout << "Unknown --wrap value: " << wrap << std::endl;
+	}
+
+	std::string filter = args.GetString("filter", "");
+	if (filter == "linear") {
+		mFilterType = GL_LINEAR;
+	} else if (filter == "nearest") {
+		mFilterType = GL_NEAREST;
+	} else if (!filter.empty()) {
+		std::cout << "Unknown --filter value: " << filter << std::endl;
+	}
+}
+
 //---------------------------------------------------------------------------
 // 셰이더 관련.
 void Example04::CreateDefaultShader() 
 {
+	PROFILE_SCOPE("Example04::CreateDefaultShader");
 	// 셰이더 소스 코드
 	const char* vertexShaderSource = R"(
 		#version 330 core
@@ -63,149 +113,38 @@ void Example04::CreateDefaultShader()
 		}
 	)";
 
-	const char* VERTEX_SHADER_CODE = vertexShaderSource;
-	const char* FRAGMENT_SHADER_CODE = fragmentShaderSource;
-
-	unsigned int vertex{};
-	unsigned int fragment{};
-	// vertex shader 생성 및 컴파일
-	vertex = glCreateShader(GL_VERTEX_SHADER);
-	glShaderSource(vertex, 1, &VERTEX_SHADER_CODE, NULL);
-	glCompileShader(vertex);
-	CheckShaderCompileErrors(vertex, "VERTEX");	// 컴파일 오류 체크
-	
-	// fragment shader 생성 및 컴파일
-	fragment = glCreateShader(GL_FRAGMENT_SHADER);
-	glShaderSource(fragment, 1, &FRAGMENT_SHADER_CODE, NULL);
-	glCompileShader(fragment);
-	CheckShaderCompileErrors(fragment, "FRAGMENT"); // 컴파일 오류 체크
-
-	// shader program 생성 및 링크
-	mDefaultShaderID = glCreateProgram();				
-	glAttachShader(mDefaultShaderID, vertex);		
-	glAttachShader(mDefaultShaderID, fragment); 
-	
-	glLinkProgram(mDefaultShaderID);	
-	CheckShaderCompileErrors(mDefaultShaderID, "PROGRAM"); 
-
-	// 셰이더 객체는 더 이상 필요 없으므로 삭제
-	glDeleteShader(vertex);
-	glDeleteShader(fragment);
+	// 같은 소스로 만든 프로그램이 이미 있으면 다시 컴파일하지 않고 그것을 쓴다.
+	mDefaultShader = mShaderCache.GetOrCreate(vertexShaderSource, fragmentShaderSource, "Example04::Default");
 }
-//---------------------------------------------------------------------------
-void Example04::CheckShaderCompileErrors(unsigned int shader, std::string type) 
-{
-	int success;
-	char infoLog[1024];
-	if (type != "PROGRAM") {
-		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-		if (!success) {
-			glGetShaderInfoLog(shader, 1024, NULL, infoLog);
-			std::cout << "ERROR::SHADER_COMPILATION_ERROR of type: " << type << "\n"
-				<< infoLog << "\n -- --------------------------------------------------- -- " 
-				<< std::endl;
-		}
-	} else {
-		glGetProgramiv(shader, GL_LINK_STATUS, &success);
-		if (!success) {
-			glGetProgramInfoLog(shader, 1024, NULL, infoLog);
-			std::cout << "ERROR::PROGRAM_LINKING_ERROR of type: " << type << "\n"
-				<< infoLog << "\n -- --------------------------------------------------- -- " 
-				<< std::endl;
-		}
-	}
-}
-
 //---------------------------------------------------------------------------
 void Example04::DeleteDefaultShader() 
 {
-	glDeleteProgram(mDefaultShaderID);
+	mDefaultShader.reset();
 }
 
 //---------------------------------------------------------------------------
 // 삼각형 렌더링 관련.
 void Example04::CreateRectangle() 
 {
-	glm::vec2 uvLeftTop{ 0};
-	glm::vec2 uvRightTop{ 0 };
-	glm::vec2 uvRightBottom{ 0 };
-	glm::vec2 uvLeftBottom{ 0 };
-
-	switch (mUvType) {
-		case UvType::Fit:
-		// 기본 UV 좌표 사용
-			uvLeftTop = glm::vec2{ 0.0f, 1.0f };
-			uvRightTop = glm::vec2{ 1.0f, 1.0f };
-			uvRightBottom = glm::vec2{ 1.0f, 0.0f };
-			uvLeftBottom = glm::vec2{ 0.0f, 0.0f };
-			break;
-		case UvType::Smaller:
-			// UV 좌표를 0.5배 축소
-			uvLeftTop = glm::vec2{ 0.25f, 0.75f };
-			uvRightTop = glm::vec2{ 0.75f, 0.75f };
-			uvRightBottom = glm::vec2{ 0.75f, 0.25f };
-			uvLeftBottom = glm::vec2{ 0.25f, 0.25f };
-
-			break;
-		case UvType::Bigger:
-			// UV 좌표를 2배 확대
-			uvLeftTop = glm::vec2{ -0.5f, 1.5f };
-			uvRightTop = glm::vec2{ 1.5f, 1.5f };
-			uvRightBottom = glm::vec2{ 1.5f, -0.5f };
-			uvLeftBottom = glm::vec2{ -0.5f, -0.5f };
-			break;
-	}
-
-	float scale = 0.8f;
-	mVertices.push_back(VertexUV(scale * glm::vec3(-1.0f, 1.0f, 0.0f), glm::vec3(1, 0, 0), uvLeftTop));     // left top
-	mVertices.push_back(VertexUV(scale * glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(0, 1, 0), uvLeftBottom));    // left bottom
-	mVertices.push_back(VertexUV(scale * glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(0, 0, 1), uvRightBottom));     // right bottom
-	mVertices.push_back(VertexUV(scale * glm::vec3(1.0f, 1.0f, 0.0f), glm::vec3(0, 0, 1), uvRightTop));      // right top
-
-	mIndices.push_back(0);  // first vertex.
-	mIndices.push_back(1);  // second vertex.
-	mIndices.push_back(2);  // third vertex.
-
-	mIndices.push_back(0);  // first vertex.
-	mIndices.push_back(2);  // second vertex.
-	mIndices.push_back(3);  // third vertex.
+	Geometry::CreateRectangle(mUvType, mVertices, mIndices);
 }
 
 //---------------------------------------------------------------------------
 void Example04::CreateVertexBuffer() 
 {
-	glGenVertexArrays(1, &mVertexArrayObjectId); // 정점 배열 객체 생성
-	glGenBuffers(1, &mVertexBufferObjectId);	// 정점 버퍼 객체 생성
-	glGenBuffers(1, &mElementBufferObjectId); // 요소 버퍼 객체 생성
-	glBindVertexArray(mVertexArrayObjectId); // 정점 배열 객체 바인딩
-	glBindBuffer(GL_ARRAY_BUFFER, mVertexBufferObjectId); // 정점 버퍼 객체 바인딩
-	glBufferData(GL_ARRAY_BUFFER, mVertices.size() * sizeof(VertexUV), mVertices.data(), GL_STATIC_DRAW); // 정점 데이터 업로드
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mElementBufferObjectId); // 요소 버퍼 객체 바인딩
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, mIndices.size() * sizeof(unsigned int), mIndices.data(), GL_STATIC_DRAW); // 요소 데이터 업로드
-	// 정점 속성 설정
-	// 위치 속성
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(VertexUV), (void*)offsetof(VertexUV, mPosition));
-	glEnableVertexAttribArray(0);
-	// 색상 속성
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(VertexUV), (void*)offsetof(VertexUV, mColor));
-	glEnableVertexAttribArray(1);
-	// 텍스처 좌표 속성
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(VertexUV), (void*)offsetof(VertexUV, mUv));
-	glEnableVertexAttribArray(2);
-	glBindBuffer(GL_ARRAY_BUFFER, 0); // 정점 버퍼 객체 바인딩 해제
-	glBindVertexArray(0); // 정점 배열 객체 바인딩 해제
+	// 정점 데이터와 요소 데이터를 메시 아레나에 업로드. 정점 속성(위치, 색상, 텍스처 좌표)은 VertexUV 포맷의 VAO 가 설정한다.
+	mMeshHandle = mMeshArena.Allocate(mVertices, mIndices);
 }
 
 //---------------------------------------------------------------------------
 void Example04::DeleteVertexBuffer() {
-	glDeleteVertexArrays(1, &mVertexArrayObjectId); // 정점 배열 객체 삭제
-	glDeleteBuffers(1, &mVertexBufferObjectId);	// 정점 버퍼 객체 삭제
-	glDeleteBuffers(1, &mElementBufferObjectId); // 요소 버퍼 객체 삭제
+	mMeshArena.Free(mMeshHandle);	// 아레나의 정점/요소 구간 반납
 }
 
 //---------------------------------------------------------------------------
 unsigned int Example04::LoadTexture(const std::string& path) 
 {
+	PROFILE_SCOPE("Example04::LoadTexture");
 	unsigned int textureID{ };
 	glGenTextures(1, &textureID);
 	glBindTexture(GL_TEXTURE_2D, textureID);
@@ -223,8 +162,12 @@ unsigned int Example04::LoadTexture(const std::string& path)
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, mFilterType); // 확대 필터링 방식 설정
 
 	int width, height, nrChannels;
-	stbi_set_flip_vertically_on_load(true); // 이미지 수직 뒤집기 설정
-	unsigned char* imgdata = stbi_load(path.c_str(), &width, &height, &nrChannels, 0);
+	stbi_set_flip_vertically_on_load_thread(true); // 이미지 수직 뒤집기 설정 (이 스레드만)
+	unsigned char* imgdata = nullptr;
+	{
+		PROFILE_SCOPE("stbi_load");
+		imgdata = stbi_load(path.c_str(), &width, &height, &nrChannels, 0);
+	}
 	if (imgdata) {
 		switch (nrChannels) {
 		case 1:
@@ -240,7 +183,10 @@ unsigned int Example04::LoadTexture(const std::string& path)
 			std::cout << "Unsupported number of channels: " << nrChannels << std::endl;
 			break;
 		}
-		glGenerateMipmap(GL_TEXTURE_2D);
+		{
+			PROFILE_SCOPE("glGenerateMipmap");
+			glGenerateMipmap(GL_TEXTURE_2D);
+		}
 		stbi_image_free(imgdata);
 	} else {
 		std::cout << "Failed to load texture at path: " << path << std::endl;
@@ -251,7 +197,13 @@ unsigned int Example04::LoadTexture(const std::string& path)
 //---------------------------------------------------------------------------
 void Example04::Initialize() 
 {
+	PROFILE_SCOPE("Example04::Initialize");
 	CreateDefaultShader();
+	if (mDefaultShader != nullptr) {
+		// 셰이더의 샘플러 유니폼에 텍스처 유닛 인덱스 설정. 프로그램에 남아 있으므로 한 번이면 된다.
+		mDefaultShader->SetSampler("texture1", 0);
+		mDefaultShader->SetSampler("texture2", 1);
+	}
 	CreateRectangle();
 	CreateVertexBuffer();
 
@@ -260,25 +212,21 @@ void Example04::Initialize()
 }
 
 //---------------------------------------------------------------------------
-void Example04::Render() 
+void Example04::Render(float alpha) 
 {
+	PROFILE_SCOPE("Example04::Render");
+	GPU_PROFILE_SCOPE(mGpuProfiler, "Example04::DrawRectangle");
+	if (mDefaultShader == nullptr) {
+		return;
+	}
 	// 렌더링에 적용할 셰이더 프로그램 사용
-	glUseProgram(mDefaultShaderID);
+	mDefaultShader->Use();
 	// 텍스처 유닛 설정 및 바인딩
-	glActiveTexture(GL_TEXTURE0);
-	glBindTexture(GL_TEXTURE_2D, mTextureId0);
-	glActiveTexture(GL_TEXTURE1);
-	glBindTexture(GL_TEXTURE_2D, mTextureId1);
-	// 셰이더의 샘플러 유니폼에 텍스처 유닛 인덱스 설정
-	glUniform1i(glGetUniformLocation(mDefaultShaderID, "texture1"), 0);
-	glUniform1i(glGetUniformLocation(mDefaultShaderID, "texture2"), 1);
-	
-	// 정점 배열 객체 바인딩
-	glBindVertexArray(mVertexArrayObjectId);
-	// 삼각형 렌더링
-	glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mIndices.size()), GL_UNSIGNED_INT, 0);
+	GlState::BindTexture(0, GL_TEXTURE_2D, mTextureId0);
+	GlState::BindTexture(1, GL_TEXTURE_2D, mTextureId1);
 	
-	glBindVertexArray(0); // 정점 배열 객체 바인딩 해제
+	// 삼각형 렌더링 (포맷별로 공유하는 VAO 에 아레나 버퍼를 붙인다. 풀지 않고 다음 프레임에도 그대로 쓴다)
+	mMeshArena.Draw(mMeshHandle);
 }
 
 //---------------------------------------------------------------------------
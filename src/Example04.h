@@ -1,30 +1,26 @@
 #pragma once
 #include "ExampleBase.h"
+#include <memory>
 #include <vector>
 #include "glm/glm.hpp"
+#include "render/ShaderProgram.h"
+#include "common/Geometry.h"
 #include "common/Vertex.h"
 
-enum class UvType
-{
-	Fit,
-	Smaller,
-	Bigger
-};
-
 class Example04 : public ExampleBase
 {
 public:
 	Example04();
 	virtual ~Example04();
 	void RunWidthParam(UvType uvType, int wrapType, int filterType);
+	virtual void Configure(const CommandLine& args) override;
 	virtual void Initialize() override;
-	virtual void Render() override;
+	virtual void Render(float alpha) override;
 	virtual void CleanUp() override;
 
 private:
 	// 셰이더 관련.
 	void CreateDefaultShader();
-	void CheckShaderCompileErrors(unsigned int shader, std::string type);
 	void DeleteDefaultShader();
 
 	// 삼각형 렌더링 관련.
@@ -36,19 +32,6 @@ private:
 	unsigned int LoadTexture(const std::string& path);
 
 private:
-	struct VertexUV {
-		glm::vec3 mPosition{ 0,0,0 };
-		glm::vec3 mColor{ 0,0,0 };
-		glm::vec2 mUv{ 0,0 };
-
-		VertexUV() {}
-		VertexUV(const glm::vec3& position, const glm::vec3& color, const glm::vec2& uv)
-			: mPosition(position), mColor(color), mUv(uv)
-		{
-		}
-
-	};
-
 	// 텍스처 좌표 계산 방식, 래핑 방식, 필터링 방식을 보관할 변수들.
 	UvType mUvType{};
 	int mWrapType{};
@@ -58,13 +41,12 @@ private:
 	std::vector<VertexUV> mVertices{};
 	std::vector<unsigned int> mIndices{};
 
-	// OpenGL에서 생성한 버퍼 ID를 보관할 변수들.
-	unsigned int mVertexArrayObjectId{};
-	unsigned int mVertexBufferObjectId{};
-	unsigned int mElementBufferObjectId{};
+	// ExampleBase 의 mMeshArena 에 올린 버텍스/인덱스 구간. (버퍼와 VAO 는 포맷별로 공유한다)
+	MeshArena::MeshHandle mMeshHandle{};
+	// OpenGL에서 생성한 텍스처 ID.
 	unsigned int mTextureId0{};
 	unsigned int mTextureId1{};
-	// OpenGL에서 사용하는 셰이더 ID를 보관할 변수.
-	unsigned int mDefaultShaderID{};
+	// 셰이더 캐시에서 받은 프로그램. (같은 소스를 쓰는 곳과 공유한다)
+	std::shared_ptr<ShaderProgram> mDefaultShader{};
 };
 
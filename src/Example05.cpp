@@ -0,0 +1,473 @@
+#include "Example05.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtc/matrix_inverse.hpp"
+
+#include "core/CommandLine.h"
+#include "core/Profiler.h"
+#include "mesh/MeshFile.h"
+#include "mesh/MeshIndices.h"
+#include "mesh/MeshOptimizer.h"
+#include "mesh/ObjLoader.h"
+#include "render/GlState.h"
+#include "ExampleRegistry.h"
+
+#include "stb/stb_image.h"
+
+REGISTER_EXAMPLE("05", Example05, "OBJ model viewer (--model, --shader, --features, --texture, --rotate, --quantize, --split-indices, --cook, --no-optimize, --bounds, --lod-count, --lod-error, --lod, --crowd)");
+
+// 서브메시(재질)마다 구분되게 칠할 색상.
+static const glm::vec3 SUBMESH_COLORS[] = {
+	glm::vec3(0.90f, 0.90f, 0.90f),
+	glm::vec3(0.95f, 0.55f, 0.20f),
+	glm::vec3(0.30f, 0.60f, 0.95f),
+	glm::vec3(0.45f, 0.85f, 0.35f),
+	glm::vec3(0.95f, 0.35f, 0.45f),
+	glm::vec3(0.70f, 0.45f, 0.90f),
+	glm::vec3(0.95f, 0.85f, 0.30f),
+	glm::vec3(0.40f, 0.85f, 0.85f),
+};
+
+//-----------------------------------------------------------------------------
+Example05::Example05()
+{
+	mTitle = "Example05_Model";
+	mModelPath = "robot/robot.obj";
+	mShaderName = "HalfLambert";
+	mRotationSpeed = 30.0f;
+}
+
+//-----------------------------------------------------------------------------
+Example05::~Example05()
+{
+}
+
+//-----------------------------------------------------------------------------
+// --model=robot/robot.obj, --shader=HalfLambert|Lambert|Rim, --features=TEXTURE,AMBIENT,
+// --texture=robot/main_texture.png, --rotate=DEG_PER_SEC, --quantize, --split-indices, --cook, --no-optimize, --bounds,
+// --lod-count=5, --lod-error=PIXELS, --lod=LEVEL, --crowd=N
+// --model 이 .mesh 이면 구워 둔 파일(MeshFile)을 읽는다.
+void Example05::Configure(const CommandLine& args)
+{
+	ExampleBase::Configure(args);
+
+	mModelPath = args.GetString("model", mModelPath);
+	mShaderName = args.GetString("shader", mShaderName);
+	mShaderFeatures = ShaderFeature::Parse(args.GetString("features"));
+	mTexturePath = args.GetString("texture", mTexturePath);
+	mRotationSpeed = static_cast<float>(args.GetDouble("rotate", mRotationSpeed));
+	mQuantize = args.Has("quantize");
+	mSplitIndices = args.Has("split-indices");
+	mCook = args.Has("cook");
+	mOptimizeMesh = !args.Has("no-optimize");
+	mShowBounds = args.Has("bounds");
+	mLodCount = std::max(args.GetInt("lod-count", mLodCount), 1);
+	mLodPixelError = static_cast<float>(args.GetDouble("lod-error", mLodPixelError));
+	mForcedLod = args.GetInt("lod", mForcedLod);
+	// 실제 한도는 모델을 올린 뒤 PerObject 링 크기로 정한다. (ClampCrowdSize)
+	mCrowdSize = std::max(args.GetInt("crowd", mCrowdSize), 1);
+
+	// 예전 이름(RimTexture 등)은 변형 하나로 합쳐졌다.
+	// 예전 LambertTexture 만 환경광을 더했으므로 그 이름은 AMBIENT 까지 켜서 같은 결과를 낸다.
+	// (Lambert 의 텍스처 변형은 예전처럼 customColor 를 곱하지 않는다)
+	const std::string TEXTURE_SUFFIX = "Texture";
+	if (mShaderName.size() > TEXTURE_SUFFIX.size()
+		&& mShaderName.compare(mShaderName.size() - TEXTURE_SUFFIX.size(), TEXTURE_SUFFIX.size(), TEXTURE_SUFFIX) == 0) {
+		mShaderName.resize(mShaderName.size() - TEXTURE_SUFFIX.size());
+		mShaderFeatures |= ShaderFeature::TEXTURE;
+		if (mShaderName == "Lambert") {
+			mShaderFeatures |= ShaderFeature::AMBIENT;
+		}
+	}
+	if (!mTexturePath.empty()) {
+		mShaderFeatures |= ShaderFeature::TEXTURE;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void Example05::CreateModelShader()
+{
+	PROFILE_SCOPE("Example05::CreateModelShader");
+	// 파일에서 만든 프로그램은 --hot-reload 로 실행하면 파일이 바뀔 때 다시 컴파일된다.
+	mModelShaders.Initialize(&mShaderCache, "../resources/shaders/" + mShaderName, mShaderName);
+	std::shared_ptr<ShaderProgram> program = mModelShaders.Get(mShaderFeatures);
+	if (program != nullptr) {
+		program->SetSampler("sample0", 0);
+	}
+	if (mShowBounds) {
+		mLineShader = mShaderCache.GetOrCreateFromFiles("../resources/shaders/VertexColor.vs", "../resources/shaders/VertexColor.fs", "VertexColor");
+	}
+}
+
+//-----------------------------------------------------------------------------
+void Example05::DeleteModelShader()
+{
+	mModelShaders.Clear();
+	mLineShader.reset();
+}
+
+//-----------------------------------------------------------------------------
+bool Example05::LoadTexture()
+{
+	PROFILE_SCOPE("Example05::LoadTexture");
+	if (mTexturePath.empty()) {
+		mTexturePath = "robot/main_texture.png";
+	}
+	std::string path = "../resources/models/" + mTexturePath;
+
+	int width{};
+	int height{};
+	int channelCount{};
+	// OBJ 의 텍스처 좌표는 아래쪽이 v = 0 이다.
+	stbi_set_flip_vertically_on_load_thread(true);
+	unsigned char* pixels = stbi_load(path.c_str(), &width, &height, &channelCount, 4);
+	if (pixels == nullptr) {
+		std::cout << "Failed to load texture at path: " << path << std::endl;
+		return false;
+	}
+
+	glGenTextures(1, &mTextureId);
+	glBindTexture(GL_TEXTURE_2D, mTextureId);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	glGenerateMipmap(GL_TEXTURE_2D);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	stbi_image_free(pixels);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool Example05::LoadModel()
+{
+	PROFILE_SCOPE("Example05::LoadModel");
+	std::string path = "../resources/models/" + mModelPath;
+	std::string extension = std::filesystem::path(path).extension().string();
+	bool loaded = (extension == ".mesh") ? MeshFile::Load(path, mMesh) : ObjLoader::Load(path, mMesh);
+	if (!loaded) {
+		return false;
+	}
+
+	// 모델 전체가 화면에 들어오도록 경계구를 구해 둔다.
+	glm::vec3 minimum(1e30f);
+	glm::vec3 maximum(-1e30f);
+	for (const ModelVertex& vertex : mMesh.vertices) {
+		minimum = glm::min(minimum, vertex.mPosition);
+		maximum = glm::max(maximum, vertex.mPosition);
+	}
+	mBoundsCenter = (minimum + maximum) * 0.5f;
+	mBoundsHalfSize = (maximum - minimum) * 0.5f;
+	mBoundsRadius = std::max(glm::length(maximum - minimum) * 0.5f, 0.001f);
+
+	std::cout << "[Example05] " << mModelPath << ": " << mMesh.vertices.size() << " vertices, "
+		<< mMesh.GetTriangleCount() << " triangles, " << mMesh.subMeshes.size() << " submeshes" << std::endl;
+
+	// 캐시/오버드로/페치 순서 최적화. 구운 파일에도 이 순서로 들어간다.
+	if (mOptimizeMesh && extension != ".mesh") {
+		PROFILE_SCOPE("MeshOptimizer::Optimize");
+		MeshOptimizer::Report report = MeshOptimizer::Optimize(mMesh);
+		std::cout << "[Example05] optimized ACMR " << report.before.acmr << " -> " << report.after.acmr
+			<< ", ATVR " << report.before.atvr << " -> " << report.after.atvr
+			<< " (FIFO " << MeshOptimizer::VERTEX_CACHE_SIZE << ")" << std::endl;
+	}
+
+	if (mCook && extension != ".mesh") {
+		std::string cookedPath = std::filesystem::path(path).replace_extension(".mesh").string();
+		std::size_t encodedIndexBytes{};
+		if (MeshFile::Save(cookedPath, mMesh, &encodedIndexBytes)) {
+			std::cout << "[Example05] cooked " << cookedPath << " (indices " << mMesh.indices.size() * sizeof(unsigned int)
+				<< " -> " << encodedIndexBytes << " bytes)" << std::endl;
+		}
+	}
+
+	// LOD 단계는 로드할 때 만든다. 접은 단계는 순서가 흐트러지므로 다시 최적화한다.
+	{
+		PROFILE_SCOPE("MeshSimplifier::BuildLodChain");
+		MeshSimplifier::BuildLodChain(mMesh, mLodCount, mLods);
+	}
+	for (std::size_t level = 1; level < mLods.size(); ++level) {
+		if (mOptimizeMesh) {
+			MeshOptimizer::Optimize(mLods[level].mesh);
+		}
+		std::cout << "[Example05] LOD " << level << ": " << mLods[level].mesh.GetTriangleCount() << " triangles, "
+			<< mLods[level].mesh.vertices.size() << " vertices, error " << mLods[level].error << std::endl;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void Example05::CreateVertexBuffer()
+{
+	// 포맷별 아레나 버퍼에 올린다. 같은 포맷의 다른 모델도 그 버퍼와 VAO 를 같이 쓴다.
+	// 인덱스 폭은 조각의 버텍스 수로 아레나가 정한다. 한도를 넘는 메시는 나눠야 16비트가 된다.
+	mLodParts.assign(mLods.size(), {});
+	for (std::size_t level = 0; level < mLods.size(); ++level) {
+		std::vector<MeshData> pieces{};
+		if (mSplitIndices) {
+			MeshIndices::Split(mLods[level].mesh, MeshIndices::MAX_16BIT_VERTEX_COUNT, pieces);
+		}
+		else {
+			pieces.push_back(mLods[level].mesh);
+		}
+
+		for (const MeshData& piece : pieces) {
+			ModelPart part{};
+			part.subMeshes = piece.subMeshes;
+			if (mQuantize) {
+				QuantizedMesh quantized{};
+				VertexQuantizer::Quantize(piece, quantized);
+				QuantizationError error = VertexQuantizer::Measure(piece, quantized);
+				std::cout << "[Example05] quantized " << piece.vertices.size() * sizeof(ModelVertex) << " -> "
+					<< quantized.vertices.size() * sizeof(QuantizedModelVertex) << " vertex bytes"
+					<< " (position max " << error.positionMax << " mean " << error.positionMean
+					<< ", normal max " << error.normalMaxDegrees << " deg, uv max " << error.uvMax
+					<< ", color max " << error.colorMax << ")" << std::endl;
+				part.handle = mMeshArena.Allocate(quantized.vertices, quantized.indices);
+				part.dequantize = quantized.GetDequantizeMatrix();
+			}
+			else {
+				part.handle = mMeshArena.Allocate(piece.vertices, piece.indices);
+			}
+			if (part.handle.IsValid()) {
+				std::cout << "[Example05] LOD " << level << " part " << mLodParts[level].size() << ": " << part.handle.vertexCount
+					<< " vertices, " << (part.handle.indexSize * 8) << "-bit indices" << std::endl;
+				mLodParts[level].push_back(part);
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void Example05::ClampCrowdSize()
+{
+	// 모델 하나는 서브메시마다 PerObject 를 한 번씩 Push 한다. (--bounds 면 하나 더)
+	// 어느 단계가 골라져도 한 프레임 그리기가 모두 PerObject 링에 들어가도록 격자 크기를 줄인다.
+	std::uint32_t pushesPerModel = 0;
+	for (const std::vector<ModelPart>& parts : mLodParts) {
+		std::uint32_t pushes = mShowBounds ? 1 : 0;
+		for (const ModelPart& part : parts) {
+			for (const SubMesh& subMesh : part.subMeshes) {
+				pushes += (subMesh.indexCount > 0) ? 1 : 0;
+			}
+		}
+		pushesPerModel = std::max(pushesPerModel, pushes);
+	}
+	if (pushesPerModel == 0) {
+		return;
+	}
+	std::uint32_t modelCount = mPerObjectUniforms.GetCapacity(sizeof(PerObjectConstants)) / pushesPerModel;
+	int maxCrowdSize = std::max(static_cast<int>(std::sqrt(static_cast<double>(modelCount))), 1);
+	if (mCrowdSize > maxCrowdSize) {
+		std::cout << "[Example05] --crowd=" << mCrowdSize << " needs " << mCrowdSize * mCrowdSize * pushesPerModel
+			<< " PerObject uploads per frame, clamped to " << maxCrowdSize << std::endl;
+		mCrowdSize = maxCrowdSize;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void Example05::DeleteVertexBuffer()
+{
+	for (std::vector<ModelPart>& parts : mLodParts) {
+		for (ModelPart& part : parts) {
+			mMeshArena.Free(part.handle);
+		}
+	}
+	mLodParts.clear();
+	mLods.clear();
+	if (mTextureId != 0) {
+		glDeleteTextures(1, &mTextureId);
+		mTextureId = 0;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void Example05::Initialize()
+{
+	PROFILE_SCOPE("Example05::Initialize");
+	CreateModelShader();
+	if (LoadModel()) {
+		CreateVertexBuffer();
+		ClampCrowdSize();
+	}
+	if ((mShaderFeatures & ShaderFeature::TEXTURE) != 0) {
+		LoadTexture();
+	}
+	GlState::SetEnabled(GL_DEPTH_TEST, true);
+}
+
+//-----------------------------------------------------------------------------
+float Example05::GetCrowdSpacing() const
+{
+	return mBoundsRadius * 2.2f;
+}
+
+//-----------------------------------------------------------------------------
+void Example05::WriteRenderState(FramePacket& packet)
+{
+	// 회전 각도는 시뮬레이션 시간으로 정한다. 렌더 스레드는 여기서 적은 변환만 읽는다.
+	// 골든 이미지 비교 때는 실행 속도에 따라 결과가 달라지지 않게 회전하지 않는다.
+	double time = packet.simulationTime + packet.alpha * mFixedTimestep.GetStepSeconds();
+	float angle = mGoldenEnabled ? 30.0f : static_cast<float>(time) * mRotationSpeed;
+	packet.parameters.push_back(static_cast<float>(time));
+
+	// --crowd 면 모델을 XZ 평면 격자로 늘어놓는다.
+	float spacing = GetCrowdSpacing();
+	float crowdExtent = static_cast<float>(mCrowdSize - 1) * spacing * 0.5f;
+	glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), glm::radians(angle), glm::vec3(0.0f, 1.0f, 0.0f));
+	for (int row = 0; row < mCrowdSize; ++row) {
+		for (int column = 0; column < mCrowdSize; ++column) {
+			glm::vec3 offset(column * spacing - crowdExtent, 0.0f, row * spacing - crowdExtent);
+			glm::mat4 model = glm::translate(glm::mat4(1.0f), offset) * rotation;
+			packet.transforms.push_back(glm::translate(model, -mBoundsCenter));
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void Example05::Render(float alpha)
+{
+	PROFILE_SCOPE("Example05::Render");
+	GPU_PROFILE_SCOPE(mGpuProfiler, "Example05::DrawModel");
+	// 같은 조합은 캐시에서 바로 나온다.
+	std::shared_ptr<ShaderProgram> shader = mModelShaders.Get(mShaderFeatures);
+	if (shader == nullptr || mLodParts.empty()) {
+		return;
+	}
+
+	// 모델 변환과 시간은 WriteRenderState 가 패킷에 적은 값이다.
+	const FramePacket& packet = GetFramePacket();
+	float time = packet.parameters.empty() ? 0.0f : packet.parameters[0];
+
+	// 격자 전체가 들어오도록 카메라를 뒤로 뺀다.
+	const float FOV_Y = glm::radians(45.0f);
+	float crowdExtent = static_cast<float>(mCrowdSize - 1) * GetCrowdSpacing() * 0.5f;
+	float aspect = (packet.framebufferHeight > 0) ? static_cast<float>(packet.framebufferWidth) / packet.framebufferHeight : 1.0f;
+	glm::vec3 cameraPosition = glm::vec3(0.0f, mBoundsRadius * 0.4f + crowdExtent * 0.3f, mBoundsRadius * 2.6f + crowdExtent * 1.5f);
+	glm::mat4 projection = glm::perspective(FOV_Y, aspect, mBoundsRadius * 0.05f, mBoundsRadius * 10.0f + crowdExtent * 4.0f);
+	glm::mat4 view = glm::lookAt(cameraPosition, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+	// 카메라와 조명은 프레임에 한 번만 올린다.
+	PerFrameConstants frame{};
+	frame.view = view;
+	frame.projection = projection;
+	frame.viewProjection = projection * view;
+	frame.cameraWorldPosition = cameraPosition;
+	frame.time = time;
+	frame.lightDirection = glm::normalize(glm::vec3(-0.4f, -1.0f, -0.6f));
+	frame.ambientIntensity = 0.1f;
+	frame.lightColor = glm::vec3(1.0f);
+	mPerFrameUniforms.Upload(UniformBlockBinding::PER_FRAME, frame);
+
+	PerObjectConstants object{};
+	shader->Use();
+	if (mTextureId != 0) {
+		GlState::BindTexture(0, GL_TEXTURE_2D, mTextureId);
+	}
+	const std::size_t COLOR_COUNT = sizeof(SUBMESH_COLORS) / sizeof(SUBMESH_COLORS[0]);
+	const int lastLevel = static_cast<int>(mLodParts.size()) - 1;
+	for (const glm::mat4& model : packet.transforms) {
+		object.normalMatrix = Std140Mat3(glm::inverseTranspose(glm::mat3(model)));
+
+		// 경계구에서 카메라에 가장 가까운 곳까지의 거리로 오차를 투영한다.
+		int level = mForcedLod;
+		if (level < 0) {
+			glm::vec3 center = glm::vec3(model * glm::vec4(mBoundsCenter, 1.0f));
+			float distance = std::max(glm::length(cameraPosition - center) - mBoundsRadius, mBoundsRadius * 0.05f);
+			level = MeshSimplifier::SelectLod(mLods, distance, static_cast<float>(packet.framebufferHeight), FOV_Y, mLodPixelError);
+		}
+		level = std::min(level, lastLevel);
+		mFullTriangleCount += mLods[0].mesh.GetTriangleCount();
+
+		for (const ModelPart& part : mLodParts[level]) {
+			// 압축 위치는 경계 상자 기준이라 복원 행렬을 모델 행렬에 합친다. 노멀은 압축과 상관없다.
+			glm::mat4 positionMatrix = model * part.dequantize;
+			object.modelMatrix = positionMatrix;
+			object.mvp = frame.viewProjection * positionMatrix;
+			for (std::size_t i = 0; i < part.subMeshes.size(); ++i) {
+				const SubMesh& subMesh = part.subMeshes[i];
+				if (subMesh.indexCount == 0) {
+					continue;
+				}
+				// 서브메시마다 링 버퍼에 자리를 받아 오프셋으로 바인딩한다.
+				object.customColor = SUBMESH_COLORS[i % COLOR_COUNT];
+				UniformRing::Allocation allocation = mPerObjectUniforms.Push(object);
+				if (!allocation.IsValid()) {
+					break;
+				}
+				mPerObjectUniforms.BindRange(UniformBlockBinding::PER_OBJECT, allocation);
+				mMeshArena.Draw(part.handle, subMesh.indexOffset, subMesh.indexCount);
+				mDrawnTriangleCount += subMesh.indexCount / 3;
+			}
+		}
+		if (mShowBounds) {
+			DrawBounds(frame.viewProjection, model);
+			shader->Use();
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void Example05::DrawBounds(const glm::mat4& viewProjection, const glm::mat4& model)
+{
+	if (mLineShader == nullptr) {
+		return;
+	}
+
+	// 매 프레임 GPU 가 보는 메모리에 바로 쓴다. stride 로 정렬해서 받으면 offset / stride 가 첫 버텍스 번호다.
+	const std::uint32_t VERTEX_COUNT = 24;
+	StreamingBuffer::Allocation allocation = mStreamingVertices.Allocate(VERTEX_COUNT * sizeof(Vertex), sizeof(Vertex));
+	if (!allocation.IsValid()) {
+		return;
+	}
+	const glm::vec3 color(1.0f, 0.85f, 0.2f);
+	Vertex* lines = reinterpret_cast<Vertex*>(allocation.data);
+	std::uint32_t count = 0;
+	for (int axis = 0; axis < 3; ++axis) {
+		// 축마다 그 축 방향의 모서리 4개.
+		int u = (axis + 1) % 3;
+		int v = (axis + 2) % 3;
+		for (int corner = 0; corner < 4; ++corner) {
+			glm::vec3 start = mBoundsCenter - mBoundsHalfSize;
+			start[u] += (corner & 1) ? 2.0f * mBoundsHalfSize[u] : 0.0f;
+			start[v] += (corner & 2) ? 2.0f * mBoundsHalfSize[v] : 0.0f;
+			glm::vec3 end = start;
+			end[axis] += 2.0f * mBoundsHalfSize[axis];
+			lines[count++] = Vertex(start, color);
+			lines[count++] = Vertex(end, color);
+		}
+	}
+	mStreamingVertices.Commit(allocation);
+
+	PerObjectConstants object{};
+	object.modelMatrix = model;
+	object.mvp = viewProjection * model;
+	UniformRing::Allocation uniforms = mPerObjectUniforms.Push(object);
+	if (!uniforms.IsValid()) {
+		return;
+	}
+	mPerObjectUniforms.BindRange(UniformBlockBinding::PER_OBJECT, uniforms);
+	mLineShader->Use();
+	mVertexArrays.Bind<Vertex>(mStreamingVertices.GetBuffer(), 0);
+	glDrawArrays(GL_LINES, static_cast<GLint>(allocation.offset / sizeof(Vertex)), static_cast<GLsizei>(VERTEX_COUNT));
+}
+
+//-----------------------------------------------------------------------------
+void Example05::CleanUp()
+{
+	if (mFullTriangleCount > 0) {
+		std::cout << "[Example05] LOD drew " << mDrawnTriangleCount << " of " << mFullTriangleCount << " triangles ("
+			<< (100.0 * static_cast<double>(mDrawnTriangleCount) / static_cast<double>(mFullTriangleCount)) << "%)" << std::endl;
+	}
+	DeleteVertexBuffer();
+	DeleteModelShader();
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "ExampleBase.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include "glm/glm.hpp"
+#include "mesh/MeshData.h"
+#include "mesh/MeshSimplifier.h"
+#include "mesh/VertexQuantizer.h"
+#include "render/ShaderFamily.h"
+#include "render/ShaderProgram.h"
+
+// resources/models 의 OBJ 모델을 resources/shaders 의 셰이더로 그리는 예제.
+// --hot-reload 로 실행하면 셰이더 파일을 고치는 대로 화면에 반영된다.
+class Example05 : public ExampleBase
+{
+public:
+	Example05();
+	virtual ~Example05();
+	virtual void Configure(const CommandLine& args) override;
+	virtual void Initialize() override;
+	virtual void WriteRenderState(FramePacket& packet) override;
+	virtual void Render(float alpha) override;
+	virtual void CleanUp() override;
+
+private:
+	// 셰이더 관련.
+	void CreateModelShader();
+	void DeleteModelShader();
+
+	// 모델 렌더링 관련.
+	bool LoadModel();
+	void CreateVertexBuffer();
+	void DeleteVertexBuffer();
+	// PerObject 링에 한 프레임 그리기가 다 들어가도록 --crowd 를 줄인다.
+	void ClampCrowdSize();
+	// --crowd 격자에서 모델 사이 간격.
+	float GetCrowdSpacing() const;
+	bool LoadTexture();
+	// 경계 상자를 스트리밍 버퍼에 선으로 써서 그린다. (--bounds)
+	void DrawBounds(const glm::mat4& viewProjection, const glm::mat4& model);
+
+private:
+	// 모델 파일(resources/models 기준)과 셰이더 이름(resources/shaders 의 .vs/.fs 이름).
+	std::string mModelPath{};
+	std::string mShaderName{};
+	// 셰이더 기능 비트(ShaderFeature)와 USE_TEXTURE 일 때 쓸 텍스처(resources/models 기준).
+	std::uint32_t mShaderFeatures{};
+	std::string mTexturePath{};
+	// 초당 회전 각도(도).
+	float mRotationSpeed{};
+	// 버텍스를 QuantizedModelVertex 로 압축해서 올린다. (--quantize)
+	bool mQuantize{};
+	// 버텍스가 16비트 인덱스 한도보다 많으면 나눠서 올린다. (--split-indices)
+	bool mSplitIndices{};
+	// 읽은 모델을 .mesh 로 구워서 모델 옆에 저장한다. (--cook)
+	bool mCook{};
+	// OBJ 를 읽은 뒤 삼각형/버텍스 순서를 최적화한다. (--no-optimize 로 끈다. .mesh 는 구울 때 이미 했다)
+	bool mOptimizeMesh{ true };
+	bool mShowBounds{};
+	// LOD 단계 수(원본 포함). 1 이면 만들지 않는다. (--lod-count)
+	int mLodCount{ 5 };
+	// 화면에 투영한 LOD 오차가 이 픽셀 이하인 가장 거친 단계를 쓴다. (--lod-error)
+	float mLodPixelError{ 1.0f };
+	// 0 이상이면 거리와 상관없이 이 단계를 쓴다. (--lod)
+	int mForcedLod{ -1 };
+	// 한 변에 모델을 이만큼씩 격자로 늘어놓는다. (--crowd, PerObject 링에 맞게 줄어든다)
+	int mCrowdSize{ 1 };
+
+	MeshData mMesh{};
+	glm::vec3 mBoundsCenter{};
+	glm::vec3 mBoundsHalfSize{};
+	float mBoundsRadius{ 1.0f };
+	// 0단계는 mMesh 와 같다. 단계별 오차로 LOD 를 고른다.
+	std::vector<MeshLod> mLods{};
+
+	// ExampleBase 의 mMeshArena 에 올린 조각. 서브메시는 그 안의 인덱스 구간으로 그린다.
+	// 나누지 않으면 조각은 하나이고, 조각마다 서브메시 개수는 mMesh 와 같다.
+	struct ModelPart
+	{
+		MeshArena::MeshHandle handle{};
+		std::vector<SubMesh> subMeshes{};
+		// 압축 위치의 복원 행렬. (압축하지 않으면 단위 행렬)
+		glm::mat4 dequantize{ 1.0f };
+	};
+	// LOD 단계마다 올린 조각들.
+	std::vector<std::vector<ModelPart>> mLodParts{};
+	// 실제로 그린 삼각형 수와 모두 0단계로 그렸을 때의 삼각형 수.
+	std::uint64_t mDrawnTriangleCount{};
+	std::uint64_t mFullTriangleCount{};
+	unsigned int mTextureId{};
+
+	// 셰이더의 값은 모두 PerFrame / PerObject uniform block 으로 넘긴다.
+	// 기능 비트 조합마다 처음 쓸 때 컴파일한다.
+	ShaderFamily mModelShaders{};
+	std::shared_ptr<ShaderProgram> mLineShader{};
+};
@@ -1,5 +1,8 @@
 #include "ExampleBase.h"
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
 #include <iostream>
 #include <string>
 #include <thread>
@@ -7,11 +10,31 @@
 #include "glad/glad.h"
 #include "GLFW/glfw3.h"
 
+#include "core/CommandLine.h"
+#include "core/Profiler.h"
+#include "render/GlState.h"
+#include "ExampleRegistry.h"
+
 //-----------------------------------------------------------------------------
 static void GlfwErrorCallback(int error, const char* description) {
   std::fprintf(stderr, "GLFW Error (%d): %s\n", error, description);
 }
 
+// 헤드리스 모드에서 프레임 수를 지정하지 않았을 때 렌더링할 프레임 수.
+static constexpr int DEFAULT_HEADLESS_FRAME_COUNT = 600;
+// 예제들이 리소스를 읽는 위치 기준의 골든 이미지 폴더와 셰이더 폴더.
+static const char* DEFAULT_GOLDEN_DIRECTORY = "../resources/golden";
+static const char* DEFAULT_SHADER_DIRECTORY = "../resources/shaders";
+// 한 프레임에 올릴 수 있는 PerObject 유니폼 크기. (256바이트 정렬로 4096번 그리기)
+static constexpr std::uint32_t PER_OBJECT_UNIFORM_BYTES = 1024 * 1024;
+// 한 프레임에 쓸 수 있는 스트리밍 버텍스 크기.
+static constexpr std::uint32_t STREAMING_VERTEX_BYTES = 4 * 1024 * 1024;
+// 포맷별 메시 버퍼의 처음 크기. 모자라면 두 배씩 늘어난다.
+static constexpr std::uint32_t MESH_ARENA_VERTEX_COUNT = 64 * 1024;
+static constexpr std::uint32_t MESH_ARENA_INDEX_COUNT = 192 * 1024;
+
+REGISTER_EXAMPLE("01", ExampleBase, "Empty window");
+
 //-----------------------------------------------------------------------------
 ExampleBase::ExampleBase() {
 	mTitle = "Example01_Window";
@@ -27,6 +50,11 @@ GLFWwindow* ExampleBase::CreateWindow(int width, int height, const std::string t
   mWindowParam.height = height;
 
 	glfwSetErrorCallback(GlfwErrorCallback);	// 에러 콜백 등록
+
+  if (mHeadless) {
+    // 디스플레이가 없는 머신에서도 돌 수 있도록 null 플랫폼을 쓴다.
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+  }
     
   if (!glfwInit()) {
     std::cerr << "glfwInit failed" << std::endl;
@@ -45,6 +73,12 @@ GLFWwindow* ExampleBase::CreateWindow(int width, int height, const std::string t
   glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 #endif
 
+  if (mHeadless) {
+    // 창은 보이지 않게 하고, 컨텍스트는 OSMesa(llvmpipe) 소프트웨어 렌더러로 만든다.
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+  }
+
   GLFWwindow* window = glfwCreateWindow(width, height, title.c_str(), nullptr, nullptr);
   if (window == nullptr) {
     std::cerr << "Failed to create GLFW window" << std::endl;
@@ -54,8 +88,8 @@ GLFWwindow* ExampleBase::CreateWindow(int width, int height, const std::string t
 
   glfwMakeContextCurrent(window);
 
-  // (선택) vsync
-  glfwSwapInterval(1);
+  // vsync 여부는 프레임 속도 조절 모드에 따른다.
+  glfwSwapInterval(mFramePacer.GetSwapInterval());
 
   // 이벤트 콜백 등록
   glfwSetFramebufferSizeCallback(window, OnGlfwSetFramebufferSizeCallback);
@@ -77,44 +111,503 @@ GLFWwindow* ExampleBase::CreateWindow(int width, int height, const std::string t
 }
 
 //-----------------------------------------------------------------------------
-void ExampleBase::Run() {
+int ExampleBase::Run() {
+	if (mHeadless) {
+		// 헤드리스에서는 수직동기가 의미 없으므로 제한 없이 돈다.
+		if (mFramePacer.GetMode() == FramePaceMode::VSync) {
+			mFramePacer.SetMode(FramePaceMode::Uncapped);
+		}
+		if (mFrameLimit <= 0) {
+			mFrameLimit = DEFAULT_HEADLESS_FRAME_COUNT;
+		}
+	}
+	if (mGoldenEnabled) {
+		// 비교할 프레임까지는 그려야 한다. 읽기가 늦게 끝나는 것은 종료할 때 기다린다.
+		if (mFrameLimit <= 0 || mFrameLimit <= mGoldenFrame) {
+			mFrameLimit = mGoldenFrame + 1;
+		}
+		mGoldenChecked = false;
+		mGoldenPassed = false;
+	}
+
+	if (!mProfileOutputPath.empty()) {
+		Profiler::SetEnabled(true);
+		Profiler::SetThreadName("main");
+	}
+
 	// 윈도우를 생성한다.
-	mGlfwWindow = CreateWindow(800, 800, mTitle);
+	{
+		PROFILE_SCOPE("CreateWindow");
+		mGlfwWindow = CreateWindow(800, 800, mTitle);
+	}
 	if (nullptr == mGlfwWindow)
 	{
 		// 문제가 발생해서 종료하게 되는 경우.
 		glfwTerminate();
-		return;
+		return 1;
 	}
-	Initialize();
 
+	mFrameStats.Reset();
+	mFrameCount = 0;
+	mSimulationFrameCount = 0;
+	mStopRequested = false;
+
+	if (mThreadedRendering) {
+		RunThreaded();
+	}
+	else {
+		RunSingleThreaded();
+	}
+
+	WriteFrameStats();
+	if (!mProfileOutputPath.empty()) {
+		Profiler::WriteChromeTrace(mProfileOutputPath);
+	}
+	// GLFW 종료
+	glfwTerminate();
+
+	if (mGoldenEnabled) {
+		if (!mGoldenChecked) {
+			std::cerr << "[Golden] " << mTitle << ": frame " << mGoldenFrame << " was never captured" << std::endl;
+		}
+		return mGoldenPassed ? 0 : 1;
+	}
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+void ExampleBase::RunSingleThreaded() {
+	InitializeRenderer();
+	ResetSimulationClock();
 
 	// 메인 루프
-	while(!glfwWindowShouldClose(mGlfwWindow)) {
-		// 화면을 특정색상으로 채움.
-		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-		// 컬러버퍼와 뎁스	버	퍼를 지운다.
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-		
-		mDeltaTime = static_cast<float>(glfwGetTime()) - mPrevTime;
+	while(!glfwWindowShouldClose(mGlfwWindow) && !mStopRequested) {
+		PROFILE_SCOPE("Frame");
+		mFramePacer.BeginFrame();
+
+		// 한 스레드에서도 같은 패킷 칸을 다시 써서 렌더 상태 벡터를 매 프레임 할당하지 않는다.
+		FramePacket& packet = mFramePackets.GetWriteBuffer();
+		packet.Reset();
+		SimulateFrame(packet);
+		RenderFrame(packet);
+
+		// 목표 프레임 시간 중 남은 시간만큼만 쉰다.
+		{
+			PROFILE_SCOPE("FramePacer::Wait");
+			mFramePacer.EndFrame();
+		}
+	}
 
-		Render();
+	ShutdownRenderer();
+}
 
-		mPrevTime = static_cast<float>(glfwGetTime());
+//-----------------------------------------------------------------------------
+void ExampleBase::RunThreaded() {
+	// GL 컨텍스트는 렌더 스레드로 넘긴다.
+	glfwMakeContextCurrent(nullptr);
 
-		// 버퍼 스왑
-		glfwSwapBuffers(mGlfwWindow);
-		// 이벤트 처리
-		glfwPollEvents();
+	mRenderThreadReady = false;
+	mPacketPending = false;
+	mReplacedPacketCount = 0;
+	mRenderedPacketCount = 0;
+	std::thread renderThread(&ExampleBase::RenderThreadMain, this);
+
+	// 렌더 스레드에서 Initialize() 가 끝나야 Update() 를 돌릴 수 있다.
+	{
+		std::unique_lock<std::mutex> lock(mPacketMutex);
+		mPacketCondition.wait(lock, [this] { return mRenderThreadReady; });
+	}
+	ResetSimulationClock();
+
+	// 메인 루프: 이벤트 처리와 시뮬레이션만 하고, 만든 패킷은 렌더 스레드로 넘긴다.
+	// 렌더 스레드가 N 프레임을 그리는 동안 여기서는 N+1 프레임을 시뮬레이션한다.
+	while (!glfwWindowShouldClose(mGlfwWindow) && !mStopRequested) {
+		PROFILE_SCOPE("Frame");
+		mFramePacer.BeginFrame();
+
+		FramePacket& packet = mFramePackets.GetWriteBuffer();
+		packet.Reset();
+		SimulateFrame(packet);
+
+		// 기다리지 않고 넘긴다. 렌더 스레드가 이전 패킷을 아직 가져가지 않았으면 새 패킷이 그 자리를 대신한다.
+		std::uint64_t renderedBefore{};
+		{
+			std::lock_guard<std::mutex> lock(mPacketMutex);
+			mFramePackets.Publish();
+			if (mPacketPending) {
+				++mReplacedPacketCount;
+			}
+			mPacketPending = true;
+			renderedBefore = mRenderedPacketCount;
+		}
+		mPacketCondition.notify_all();
+
+		// VSync / Uncapped 는 렌더 스레드가 속도를 정한다. 그리지도 못할 패킷을 만들며 헛돌지 않게 한 프레임 그릴 때까지 쉰다.
+		// (넘기는 것과는 상관없으므로 렌더 스레드가 늦어도 다음 패킷은 바로 넘어간다. FixedTarget 은 FramePacer 가 쉰다)
+		if (mFramePacer.GetMode() != FramePaceMode::FixedTarget) {
+			PROFILE_SCOPE("WaitRenderThread");
+			std::unique_lock<std::mutex> lock(mPacketMutex);
+			mPacketCondition.wait_for(lock, std::chrono::milliseconds(100), [this, renderedBefore] {
+				return mRenderedPacketCount != renderedBefore || mStopRequested;
+			});
+		}
 
-		// CPU 쉬는 시간 주기(점유율 조절)		
-		std::this_thread::sleep_for(std::chrono::milliseconds(1000 / 60));
+		{
+			PROFILE_SCOPE("FramePacer::Wait");
+			mFramePacer.EndFrame();
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mPacketMutex);
+		mStopRequested = true;
+	}
+	mPacketCondition.notify_all();
+	renderThread.join();
+
+	if (mReplacedPacketCount > 0) {
+		std::cout << "[RenderThread] " << mReplacedPacketCount << " frame packets were replaced before rendering" << std::endl;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void ExampleBase::RenderThreadMain() {
+	if (Profiler::IsEnabled()) {
+		Profiler::SetThreadName("render");
+	}
+
+	glfwMakeContextCurrent(mGlfwWindow);
+	InitializeRenderer();
+
+	{
+		std::lock_guard<std::mutex> lock(mPacketMutex);
+		mRenderThreadReady = true;
+	}
+	mPacketCondition.notify_all();
+
+	while (true) {
+		{
+			PROFILE_SCOPE("WaitFramePacket");
+			std::unique_lock<std::mutex> lock(mPacketMutex);
+			mPacketCondition.wait(lock, [this] { return mPacketPending || mStopRequested; });
+			if (mStopRequested) {
+				break;
+			}
+			mFramePackets.Acquire();
+			mPacketPending = false;
+		}
+
+		{
+			PROFILE_SCOPE("RenderThreadFrame");
+			RenderFrame(mFramePackets.GetReadBuffer());
+		}
+		{
+			std::lock_guard<std::mutex> lock(mPacketMutex);
+			++mRenderedPacketCount;
+		}
+		mPacketCondition.notify_all();
+	}
+
+	// 프레임 수 제한으로 여기서 멈춘 경우에도 메인 스레드가 기다리지 않고 빠져나가게 깨운다.
+	{
+		std::lock_guard<std::mutex> lock(mPacketMutex);
+		mStopRequested = true;
+	}
+	mPacketCondition.notify_all();
+
+	ShutdownRenderer();
+	glfwMakeContextCurrent(nullptr);
+}
+
+//-----------------------------------------------------------------------------
+void ExampleBase::InitializeRenderer() {
+	// 새 컨텍스트라서 이전 예제에서 기억해 둔 GL 상태는 맞지 않는다.
+	GlState::Invalidate();
+	GlState::ResetStats();
+	glfwSwapInterval(mFramePacer.GetSwapInterval());
+	mAppliedSwapInterval = mFramePacer.GetSwapInterval();
+	mViewportWidth = 0;
+	mViewportHeight = 0;
+
+	// 골든 이미지 테스트는 창 크기와 상관없이 처음 크기의 오프스크린 버퍼에 그린다.
+	if (mGoldenEnabled) {
+		mOffscreenTarget.Create(mWindowParam.width, mWindowParam.height);
+		mPixelReadback.Initialize(mWindowParam.width, mWindowParam.height);
+		mPixelReadback.SetCallback([this](std::int64_t frameIndex, const Image& image) {
+			CheckGoldenImage(image);
+		});
+	}
+
+	// GPU 타이머 쿼리 결과는 몇 프레임 늦게 도착하므로 도착하는 대로 프레임 통계에 채운다.
+	mGpuProfiler.Initialize();
+	mGpuProfiler.SetResultCallback([this](std::int64_t frameIndex, const std::vector<GpuProfiler::ZoneResult>& zones, double frameMs) {
+		mFrameStats.RecordGpuFrame(frameIndex, frameMs);
+		for (const GpuProfiler::ZoneResult& zone : zones) {
+			mFrameStats.RecordGpuZone(zone.name, zone.milliseconds);
+		}
+	});
+
+	// 이전 실행에서 저장한 프로그램 바이너리가 있으면 셰이더 컴파일을 건너뛴다.
+	if (!mShaderBinaryDirectory.empty()) {
+		mShaderCache.EnableBinaryCache(mShaderBinaryDirectory);
+	}
+	mPerFrameUniforms.Create(sizeof(PerFrameConstants));
+	mPerObjectUniforms.Initialize(PER_OBJECT_UNIFORM_BYTES);
+	mStreamingVertices.Initialize(STREAMING_VERTEX_BYTES);
+	mMeshArena.Initialize(&mVertexArrays, MESH_ARENA_VERTEX_COUNT, MESH_ARENA_INDEX_COUNT);
+
+	// 예제가 쓸 셰이더를 미리 한꺼번에 만들어 두면 Initialize() 의 GetOrCreate 는 캐시에서 바로 나온다.
+	if (!mShaderPreloadDirectory.empty()) {
+		mShaderLibrary.AddDirectory(mShaderPreloadDirectory);
+		mShaderLibrary.Load(mShaderCache);
+	}
+
+	{
+		PROFILE_SCOPE("Initialize");
+		Initialize();
+	}
+	// 초기화 코드는 GL 을 직접 바인딩하므로 렌더링 전에 기억한 상태를 버린다.
+	GlState::Invalidate();
+
+	if (!mShaderHotReloadDirectory.empty()) {
+		mShaderHotReload.Initialize(&mShaderCache, mShaderHotReloadDirectory);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void ExampleBase::ShutdownRenderer() {
+	// 아직 안 끝난 화면 읽기는 여기서 기다려서 마무리한다.
+	if (mGoldenEnabled) {
+		mPixelReadback.Collect(true);
+		mPixelReadback.Shutdown();
+		mOffscreenTarget.Destroy();
 	}
 
 	// 자원 해제
-	CleanUp();
-	// GLFW 종료
-	glfwTerminate();
+	{
+		PROFILE_SCOPE("CleanUp");
+		CleanUp();
+	}
+	GlState::Invalidate();
+	const GlState::Stats& glStats = GlState::GetStats();
+	std::uint64_t glCalls = glStats.issued + glStats.filtered;
+	if (glCalls > 0) {
+		std::cout << "[GlState] state calls " << glCalls << ", issued " << glStats.issued
+			<< ", filtered " << glStats.filtered << " (" << (100.0 * glStats.filtered / glCalls) << "%)" << std::endl;
+	}
+	mShaderHotReload.Shutdown();
+	mShaderLibrary.Clear();
+	mPerObjectUniforms.Shutdown();
+	if (mStreamingVertices.GetWaitCount() > 0 || mStreamingVertices.GetOverflowCount() > 0) {
+		std::cout << "[StreamingBuffer] fence waits " << mStreamingVertices.GetWaitCount()
+			<< ", overflows " << mStreamingVertices.GetOverflowCount() << std::endl;
+	}
+	mVertexArrays.DetachBuffer(mStreamingVertices.GetBuffer());
+	mStreamingVertices.Shutdown();
+	mPerFrameUniforms.Destroy();
+	if (mMeshArena.GetPoolCount() > 0) {
+		std::cout << "[MeshArena] pools " << mMeshArena.GetPoolCount() << ", capacity " << mMeshArena.GetCapacityBytes()
+			<< " bytes, grown " << mMeshArena.GetGrowCount() << " times" << std::endl;
+	}
+	mMeshArena.Clear();
+	mVertexArrays.Clear();
+	// 예제가 놓은 뒤에도 캐시가 쥐고 있는 프로그램들을 컨텍스트가 살아 있을 때 지운다.
+	const ProgramBinaryCache& binaryCache = mShaderCache.GetBinaryCache();
+	if (mShaderCache.GetMissCount() > 0) {
+		std::cout << "[ShaderCache] programs " << mShaderCache.GetProgramCount()
+			<< ", loaded from binary " << binaryCache.GetLoadCount()
+			<< ", compiled " << (mShaderCache.GetMissCount() - binaryCache.GetLoadCount())
+			<< ", stale binaries " << binaryCache.GetRejectCount() << std::endl;
+	}
+	mShaderCache.Clear();
+	mGpuProfiler.Shutdown();
+}
+
+//-----------------------------------------------------------------------------
+void ExampleBase::ResetSimulationClock() {
+	// 초기화에 걸린 시간이 첫 프레임에 몰리지 않도록 시계를 여기서부터 잰다.
+	mClock.Reset();
+	mPrevTicks = mClock.Now();
+	mLastRenderTicks = mPrevTicks;
+	mFixedTimestep.Reset();
+}
+
+//-----------------------------------------------------------------------------
+void ExampleBase::SimulateFrame(FramePacket& packet) {
+	GameClock::Ticks pollStart = mClock.Now();
+	// 이벤트 처리
+	{
+		PROFILE_SCOPE("PollEvents");
+		glfwPollEvents();
+	}
+
+	GameClock::Ticks now = mClock.Now();
+	GameClock::Ticks frameTicks = now - mPrevTicks;
+	mPrevTicks = now;
+	mDeltaTime = GameClock::ToSeconds(frameTicks);
+
+	// 고정 간격 시뮬레이션을 밀린 만큼 돌린다.
+	int steps = mFixedTimestep.Advance(frameTicks);
+	for (int i = 0; i < steps; ++i) {
+		PROFILE_SCOPE("Update");
+		Update(mFixedTimestep.GetStepSeconds());
+	}
+	GameClock::Ticks updateEnd = mClock.Now();
+
+	packet.frameIndex = mSimulationFrameCount++;
+	packet.alpha = mFixedTimestep.GetAlpha();
+	packet.simulationTime = mFixedTimestep.GetSimulationTime();
+	packet.deltaTime = mDeltaTime;
+	packet.framebufferWidth = mWindowParam.width;
+	packet.framebufferHeight = mWindowParam.height;
+	packet.swapInterval = mFramePacer.GetSwapInterval();
+	packet.pollMs = GameClock::ToSeconds(now - pollStart) * 1000.0;
+	packet.updateMs = GameClock::ToSeconds(updateEnd - now) * 1000.0;
+
+	// 예제의 시뮬레이션 상태는 여기서 패킷으로 복사되고, 렌더링은 패킷만 본다.
+	WriteRenderState(packet);
+}
+
+//-----------------------------------------------------------------------------
+void ExampleBase::RenderFrame(const FramePacket& packet) {
+	GameClock::Ticks renderStart = mClock.Now();
+	mRenderPacket = &packet;
+
+	// 창 크기나 vsync 설정이 바뀌었으면 GL 컨텍스트를 가진 스레드에서 반영한다.
+	if (mOffscreenTarget.IsValid()) {
+		mOffscreenTarget.Bind();
+	}
+	else if (packet.framebufferWidth != mViewportWidth || packet.framebufferHeight != mViewportHeight) {
+		glViewport(0, 0, packet.framebufferWidth, packet.framebufferHeight);
+		mViewportWidth = packet.framebufferWidth;
+		mViewportHeight = packet.framebufferHeight;
+	}
+	if (packet.swapInterval != mAppliedSwapInterval) {
+		glfwSwapInterval(packet.swapInterval);
+		mAppliedSwapInterval = packet.swapInterval;
+	}
+
+	// 바뀐 셰이더 파일이 있으면 컴파일을 걸고, 끝난 것은 이번 프레임부터 쓴다.
+	mShaderHotReload.Update();
+
+	mGpuProfiler.BeginFrame(mFrameCount);
+	{
+		PROFILE_SCOPE("Render");
+		{
+			GPU_PROFILE_SCOPE(mGpuProfiler, "Clear");
+			// 화면을 특정색상으로 채움.
+			glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+			// 컬러버퍼와 뎁스	버	퍼를 지운다.
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		}
+
+		GPU_PROFILE_SCOPE(mGpuProfiler, "Render");
+		mPerObjectUniforms.BeginFrame();
+		mStreamingVertices.BeginFrame();
+		Render(packet.alpha);
+		mStreamingVertices.EndFrame();
+		mPerObjectUniforms.EndFrame();
+	}
+	if (mOffscreenTarget.IsValid()) {
+		PROFILE_SCOPE("Readback");
+		// 지난 프레임들에 건 읽기 중 끝난 것을 가져가고, 비교할 프레임이면 새로 건다.
+		mPixelReadback.Collect();
+		if (mFrameCount == mGoldenFrame) {
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, mOffscreenTarget.GetFramebuffer());
+			mPixelReadback.Request(mFrameCount);
+		}
+		mOffscreenTarget.BlitToDefault(packet.framebufferWidth, packet.framebufferHeight);
+	}
+	mGpuProfiler.EndFrame();
+	GameClock::Ticks renderEnd = mClock.Now();
+
+	// 버퍼 스왑
+	{
+		PROFILE_SCOPE("SwapBuffers");
+		glfwSwapBuffers(mGlfwWindow);
+	}
+	GameClock::Ticks swapEnd = mClock.Now();
+	mRenderPacket = nullptr;
+
+	// 구간별 시간 기록. 전체 시간은 이전 프레임 렌더링 시작부터 이번 프레임 렌더링 시작까지.
+	FrameTiming timing{};
+	timing.frameIndex = mFrameCount;
+	timing.updateMs = packet.updateMs;
+	timing.pollMs = packet.pollMs;
+	timing.renderMs = GameClock::ToSeconds(renderEnd - renderStart) * 1000.0;
+	timing.swapMs = GameClock::ToSeconds(swapEnd - renderEnd) * 1000.0;
+	timing.totalMs = GameClock::ToSeconds(renderStart - mLastRenderTicks) * 1000.0;
+	mLastRenderTicks = renderStart;
+	mFrameStats.Record(timing);
+
+	// 지정한 프레임 수를 채우면 종료한다.
+	++mFrameCount;
+	if (mFrameLimit > 0 && mFrameCount >= mFrameLimit) {
+		mStopRequested = true;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void ExampleBase::CheckGoldenImage(const Image& image) {
+	namespace fs = std::filesystem;
+	mGoldenChecked = true;
+
+	fs::path referencePath = fs::path(mGoldenDirectory) / (mTitle + ".png");
+	if (mGoldenUpdate) {
+		// 기준 이미지는 --update-golden 일 때만 쓴다.
+		std::error_code error{};
+		fs::create_directories(referencePath.parent_path(), error);
+		mGoldenPassed = ImageIo::WritePng(referencePath.string(), image);
+		std::cout << "[Golden] " << mTitle << ": " << (mGoldenPassed ? "wrote reference " : "failed to write reference ")
+			<< referencePath.string() << std::endl;
+		return;
+	}
+
+	// 기준 이미지가 없거나 읽을 수 없으면 실패다. 덮어쓰지 않는다.
+	Image reference{};
+	if (!ImageIo::LoadPng(referencePath.string(), reference)) {
+		mGoldenPassed = false;
+		std::cout << "[Golden] " << mTitle << ": FAIL missing or unreadable reference " << referencePath.string()
+			<< " (run with --update-golden to create it)" << std::endl;
+		ImageIo::WritePng(mTitle + "_actual.png", image);
+		return;
+	}
+
+	Image diffImage{};
+	ImageDiff diff = ImageIo::Compare(image, reference, mGoldenTolerance, &diffImage);
+	mGoldenPassed = diff.sizeMatches && diff.GetMismatchRatio() <= mGoldenMaxMismatchRatio;
+
+	if (!diff.sizeMatches) {
+		std::cout << "[Golden] " << mTitle << ": FAIL size " << image.width << "x" << image.height
+			<< " != reference " << reference.width << "x" << reference.height << std::endl;
+	}
+	else {
+		std::cout << "[Golden] " << mTitle << ": " << (mGoldenPassed ? "PASS" : "FAIL")
+			<< " mismatched " << diff.mismatchedPixels << "/" << diff.totalPixels
+			<< " (" << diff.GetMismatchRatio() * 100.0 << "%), max diff " << diff.maxChannelDifference
+			<< ", mean abs error " << diff.meanAbsoluteError << std::endl;
+	}
+
+	// 실패하면 결과와 차이 이미지를 남겨서 무엇이 달라졌는지 볼 수 있게 한다.
+	if (!mGoldenPassed) {
+		ImageIo::WritePng(mTitle + "_actual.png", image);
+		if (diff.sizeMatches) {
+			ImageIo::WritePng(mTitle + "_diff.png", diffImage);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void ExampleBase::WriteFrameStats() {
+	mFrameStats.PrintSummary(std::cout);
+
+	// 파일은 경로를 지정했을 때(--report)만 쓴다. 실행할 때마다 작업 폴더에 파일이 쌓이지 않게 한다.
+	if (!mFrameStatsCsvPath.empty()) {
+		mFrameStats.WriteCsv(mFrameStatsCsvPath);
+	}
+	if (!mFrameStatsJsonPath.empty()) {
+		mFrameStats.WriteJson(mFrameStatsJsonPath, mTitle);
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -123,7 +616,17 @@ void ExampleBase::Initialize()
 
 }
 //-----------------------------------------------------------------------------
-void ExampleBase::Render()
+void ExampleBase::Update(double dt)
+{
+
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::WriteRenderState(FramePacket& packet)
+{
+
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::Render(float alpha)
 {
 
 }
@@ -131,6 +634,165 @@ void ExampleBase::Render()
 void ExampleBase::CleanUp()
 {
 
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::Configure(const CommandLine& args) {
+	if (args.Has("headless")) {
+		SetHeadless(true);
+	}
+	if (args.Has("threaded")) {
+		SetThreadedRendering(true);
+	}
+	SetFrameLimit(args.GetInt("frames", mFrameLimit));
+
+	// 프레임 속도: --uncapped, --vsync, --fps=N (목표 FPS 고정)
+	if (args.Has("uncapped")) {
+		SetFramePaceMode(FramePaceMode::Uncapped);
+	}
+	else if (args.Has("fps")) {
+		SetTargetFps(args.GetDouble("fps", mFramePacer.GetTargetFps()));
+		SetFramePaceMode(FramePaceMode::FixedTarget);
+	}
+	else if (args.Has("vsync")) {
+		SetFramePaceMode(FramePaceMode::VSync);
+	}
+	SetSimulationRate(args.GetDouble("sim-rate", mFixedTimestep.GetStepRate()));
+
+	// --report=out.json 이면 같은 이름의 .csv 도 함께 저장한다. 경로 없이 --report 만 주면 예제 이름으로 저장한다.
+	if (args.Has("report")) {
+		std::string jsonPath = args.GetString("report");
+		if (jsonPath.empty()) {
+			jsonPath = mTitle + "_frame_stats.json";
+		}
+		std::string csvPath = jsonPath;
+		std::string::size_type dot = csvPath.rfind('.');
+		if (dot != std::string::npos && csvPath.substr(dot) == ".json") {
+			csvPath = csvPath.substr(0, dot);
+		}
+		SetFrameStatsOutput(csvPath + ".csv", jsonPath);
+	}
+	if (args.Has("trace")) {
+		SetProfileOutput(args.GetString("trace"));
+	}
+
+	// 골든 이미지: --golden[=DIR], --update-golden, --golden-frame=N, --golden-tolerance=N, --golden-max-mismatch=R
+	bool updateGolden = args.Has("update-golden");
+	if (args.Has("golden") || updateGolden) {
+		std::string directory = args.GetString("golden");
+		SetGoldenTest(directory.empty() ? DEFAULT_GOLDEN_DIRECTORY : directory, updateGolden);
+	}
+	SetGoldenFrame(args.GetInt("golden-frame", mGoldenFrame));
+	SetGoldenTolerance(args.GetInt("golden-tolerance", mGoldenTolerance),
+		args.GetDouble("golden-max-mismatch", mGoldenMaxMismatchRatio));
+
+	// 셰이더 바이너리 캐시: --shader-cache=DIR, --no-shader-cache
+	if (args.Has("no-shader-cache")) {
+		SetShaderBinaryCache("");
+	}
+	else {
+		SetShaderBinaryCache(args.GetString("shader-cache", mShaderBinaryDirectory));
+	}
+	if (args.Has("hot-reload")) {
+		std::string directory = args.GetString("hot-reload");
+		SetShaderHotReload(directory.empty() ? DEFAULT_SHADER_DIRECTORY : directory);
+	}
+	if (args.Has("preload-shaders")) {
+		std::string directory = args.GetString("preload-shaders");
+		SetShaderPreload(directory.empty() ? DEFAULT_SHADER_DIRECTORY : directory);
+	}
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::PrintCommonOptions() {
+	std::cout
+		<< "  --frames=N        render N frames and exit\n"
+		<< "  --uncapped        no frame rate limit (benchmark)\n"
+		<< "  --vsync           lock to display refresh (default)\n"
+		<< "  --fps=N           fixed target frame rate\n"
+		<< "  --sim-rate=HZ     Update() rate (default 120)\n"
+		<< "  --headless        offscreen OSMesa context, no display needed\n"
+		<< "  --threaded        use the GL context on a dedicated render thread\n"
+		<< "  --report[=PATH]   write frame stats to PATH (.json) and .csv (default <title>_frame_stats.json)\n"
+		<< "  --trace=PATH      write CPU profile as Chrome trace JSON\n"
+		<< "  --golden[=DIR]    render offscreen and compare a frame with DIR/<title>.png\n"
+		<< "                    (default DIR ../resources/golden, a missing reference fails)\n"
+		<< "  --update-golden   overwrite the reference images\n"
+		<< "  --golden-frame=N  frame to compare (default 60)\n"
+		<< "  --golden-tolerance=N      per-channel tolerance (default 8)\n"
+		<< "  --golden-max-mismatch=R   allowed ratio of mismatched pixels (default 0.001)\n"
+		<< "  --shader-cache=DIR        program binary cache folder (default shader_cache)\n"
+		<< "  --no-shader-cache         always compile shaders from source\n"
+		<< "  --hot-reload[=DIR]        recompile shaders when files in DIR change (default ../resources/shaders)\n"
+		<< "  --preload-shaders[=DIR]   compile every shader pair in DIR in parallel at startup\n";
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetFramePaceMode(FramePaceMode mode) {
+	// swap interval 은 다음 프레임 패킷을 통해 렌더링하는 쪽에서 바꾼다.
+	mFramePacer.SetMode(mode);
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetTargetFps(double fps) {
+	mFramePacer.SetTargetFps(fps);
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetSimulationRate(double hz) {
+	mFixedTimestep.SetStepRate(hz);
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetMaxUpdatesPerFrame(int maxUpdates) {
+	mFixedTimestep.SetMaxStepsPerFrame(maxUpdates);
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetHeadless(bool headless) {
+	mHeadless = headless;
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetFrameLimit(int frameCount) {
+	mFrameLimit = frameCount;
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetFrameStatsOutput(const std::string& csvPath, const std::string& jsonPath) {
+	mFrameStatsCsvPath = csvPath;
+	mFrameStatsJsonPath = jsonPath;
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetThreadedRendering(bool threaded) {
+	mThreadedRendering = threaded;
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetGoldenTest(const std::string& directory, bool update) {
+	mGoldenEnabled = true;
+	mGoldenDirectory = directory;
+	mGoldenUpdate = update;
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetGoldenFrame(int frameIndex) {
+	mGoldenFrame = std::max(frameIndex, 0);
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetGoldenTolerance(int tolerance, double maxMismatchRatio) {
+	mGoldenTolerance = tolerance;
+	mGoldenMaxMismatchRatio = maxMismatchRatio;
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetShaderBinaryCache(const std::string& directory) {
+	mShaderBinaryDirectory = directory;
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetShaderHotReload(const std::string& directory) {
+	mShaderHotReloadDirectory = directory;
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetShaderPreload(const std::string& directory) {
+	mShaderPreloadDirectory = directory;
+}
+//-----------------------------------------------------------------------------
+const FramePacket& ExampleBase::GetFramePacket() const {
+	static const FramePacket EMPTY_PACKET{};
+	return (mRenderPacket != nullptr) ? *mRenderPacket : EMPTY_PACKET;
+}
+//-----------------------------------------------------------------------------
+void ExampleBase::SetProfileOutput(const std::string& path) {
+	mProfileOutputPath = path;
 }
 //-----------------------------------------------------------------------------
 void ExampleBase::SetCursorVisible(bool visible) {
@@ -185,7 +847,7 @@ void ExampleBase::OnGlfwSetScrollCallback(GLFWwindow* window, double xoffset, do
 }
 //-----------------------------------------------------------------------------
 void ExampleBase::OnFramebufferSizeChanged(int width, int height) {
-	glViewport(0, 0, width, height);
+	// glViewport 는 GL 컨텍스트를 가진 스레드가 다음 프레임을 그릴 때 적용한다.
 	mWindowParam.width = width;
 	mWindowParam.height = height;	
 	//std::cout << "[OnFramebufferSizeChanged] " << width << ", " << height << std::endl;
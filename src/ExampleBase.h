@@ -1,25 +1,94 @@
 #pragma once
+#include <atomic>
+#include <condition_variable>
 #include <map>
+#include <mutex>
 #include <string>
 
 #include "glm/glm.hpp"
 
 #include "common/WindowParam.h"
+#include "core/FixedTimestep.h"
+#include "core/FramePacer.h"
+#include "core/FramePacket.h"
+#include "core/FrameStats.h"
+#include "core/GameClock.h"
+#include "core/TripleBuffer.h"
+#include "render/GpuProfiler.h"
+#include "render/MeshArena.h"
+#include "render/OffscreenTarget.h"
+#include "render/PixelReadback.h"
+#include "render/ShaderCache.h"
+#include "render/ShaderHotReload.h"
+#include "render/ShaderLibrary.h"
+#include "render/StreamingBuffer.h"
+#include "render/UniformBlocks.h"
+#include "render/UniformBuffer.h"
+#include "render/UniformRing.h"
+#include "render/VertexArrayCache.h"
 
 
 struct GLFWwindow;
+class CommandLine;
 
 class ExampleBase {
 public:
 	ExampleBase();
 	virtual ~ExampleBase();
-	void Run();
+	// 실행하고 종료 코드를 돌려준다. 골든 이미지 비교가 실패하면 0 이 아니다.
+	int Run();
 
 	// 예제가 구현해야 하는 가상 함수들
+	// Initialize, Render, CleanUp 은 GL 컨텍스트를 가진 스레드에서 호출된다.
+	// (렌더 스레드를 쓰면 렌더 스레드, 아니면 메인 스레드)
 	virtual void Initialize();
-	virtual void Render();
+	// 고정 간격(기본 120Hz)으로 메인 스레드에서 호출되는 시뮬레이션 업데이트. dt 는 초 단위 스텝 간격.
+	virtual void Update(double dt);
+	// Update 가 끝난 뒤 메인 스레드에서 호출된다. 렌더링에 필요한 시뮬레이션 상태를 패킷에 적는다.
+	virtual void WriteRenderState(FramePacket& packet);
+	// 렌더링. alpha 는 직전 Update 와 다음 Update 사이의 보간 계수 [0, 1).
+	// 렌더 스레드를 쓰면 Update 와 동시에 돌므로, Update 가 바꾸는 값은 멤버 대신 GetFramePacket() 으로 읽는다.
+	// Initialize 에서 정한 멤버(자원, 옵션)는 그 뒤로 바꾸지 않으므로 그대로 읽어도 된다.
+	virtual void Render(float alpha);
 	virtual void CleanUp();
 
+	// 명령행 옵션으로 실행 설정을 바꾼다. Run() 전에 호출한다.
+	// 예제별 옵션이 있으면 재정의하고 ExampleBase::Configure 도 불러준다.
+	virtual void Configure(const CommandLine& args);
+	// Configure 가 읽는 공통 옵션 설명.
+	static void PrintCommonOptions();
+
+	// 프레임 속도 조절 설정. Run() 전에 호출한다.
+	void SetFramePaceMode(FramePaceMode mode);
+	void SetTargetFps(double fps);
+	// 시뮬레이션 업데이트 주기와 한 프레임에 따라잡을 최대 스텝 수.
+	void SetSimulationRate(double hz);
+	void SetMaxUpdatesPerFrame(int maxUpdates);
+	// 화면 없이(GLFW null 플랫폼 + OSMesa) 오프스크린 컨텍스트에서 실행한다.
+	void SetHeadless(bool headless);
+	// 지정한 프레임 수만큼 렌더링하고 종료한다. 0 이면 창을 닫을 때까지 돈다.
+	void SetFrameLimit(int frameCount);
+	// 종료할 때 프레임 시간 통계를 저장할 경로. 빈 문자열이면 저장하지 않는다.
+	void SetFrameStatsOutput(const std::string& csvPath, const std::string& jsonPath);
+	// CPU 프로파일 결과(Chrome trace JSON)를 저장할 경로. 지정하면 프로파일러가 켜진다.
+	void SetProfileOutput(const std::string& path);
+	// GL 컨텍스트를 전용 렌더 스레드로 옮긴다. 메인 스레드는 이벤트 처리와 Update 만 하고
+	// 프레임 패킷을 삼중 버퍼로 넘겨서, N+1 프레임 시뮬레이션과 N 프레임 렌더링이 겹쳐서 돈다.
+	// 넘길 때 기다리지 않는다. 렌더 스레드가 아직 가져가지 않은 패킷은 새 패킷으로 바뀐다.
+	void SetThreadedRendering(bool threaded);
+	// 골든 이미지 테스트. 오프스크린 프레임버퍼에 그리고 goldenFrame 번째 프레임을 PBO 로 읽어서
+	// directory 의 "<제목>.png" 와 비교한다. 기준 이미지가 없거나 update 이면 새로 저장한다.
+	void SetGoldenTest(const std::string& directory, bool update);
+	void SetGoldenFrame(int frameIndex);
+	// 채널 차이가 tolerance 를 넘는 픽셀 비율이 maxMismatchRatio 이하면 통과.
+	void SetGoldenTolerance(int tolerance, double maxMismatchRatio);
+	// 링크된 셰이더 프로그램 바이너리를 저장할 폴더. 빈 문자열이면 디스크 캐시를 쓰지 않는다.
+	void SetShaderBinaryCache(const std::string& directory);
+	// 셰이더 폴더를 감시하다가 바뀐 파일로 만든 프로그램을 다시 컴파일한다. 빈 문자열이면 끈다.
+	void SetShaderHotReload(const std::string& directory);
+	// Initialize() 전에 DIR 의 셰이더를 모두 병렬로 읽고 컴파일해서 캐시에 넣어 둔다.
+	void SetShaderPreload(const std::string& directory);
+
 	void SetCursorVisible(bool visible);
 	bool GetKeyState(int key);
 	glm::vec2 GetMouseWheelOffset();
@@ -28,6 +97,31 @@ public:
 
 protected:
 	GLFWwindow* CreateWindow(int width, int height, const std::string title);
+	// 프레임 시간 통계를 출력하고, 저장할 경로가 있으면 파일로도 저장한다.
+	void WriteFrameStats();
+
+	// 메인 루프. 단일 스레드 / 렌더 스레드 분리.
+	void RunSingleThreaded();
+	void RunThreaded();
+	void RenderThreadMain();
+
+	// GL 컨텍스트를 가진 스레드에서 호출되는 초기화/정리.
+	void InitializeRenderer();
+	void ShutdownRenderer();
+
+	void ResetSimulationClock();
+	// 이벤트 처리와 고정 간격 Update 를 돌리고 렌더링에 필요한 값을 패킷에 채운다.
+	void SimulateFrame(FramePacket& packet);
+	// 패킷 하나를 렌더링하고 스왑한다.
+	void RenderFrame(const FramePacket& packet);
+
+	// Render() 안에서 현재 그리고 있는 프레임 패킷. 렌더 스레드에서는 mDeltaTime 대신 이 값을 쓴다.
+	const FramePacket& GetFramePacket() const;
+	ShaderCache& GetShaderCache() { return mShaderCache; }
+	const ShaderLibrary& GetShaderLibrary() const { return mShaderLibrary; }
+
+	// 읽어온 화면을 기준 이미지와 비교한다. (PixelReadback 콜백)
+	void CheckGoldenImage(const Image& image);
 
 	// 윈도우 이벤트를 받을 콜백 함수들.
 	static void OnGlfwSetFramebufferSizeCallback(GLFWwindow* window, int width, int height);
@@ -46,8 +140,77 @@ protected:
 	GLFWwindow* mGlfwWindow{};
 	std::string mTitle{};
 
-	float mDeltaTime{};
-	float mPrevTime{};
+	bool mHeadless{};
+	int mFrameLimit{};
+	// 렌더링한 프레임 수(렌더링 쪽)와 시뮬레이션한 프레임 수(메인 스레드 쪽).
+	int mFrameCount{};
+	std::int64_t mSimulationFrameCount{};
+	std::atomic<bool> mStopRequested{};
+
+	// 직전 프레임과의 시간 간격(초).
+	double mDeltaTime{};
+
+	GameClock mClock{};
+	GameClock::Ticks mPrevTicks{};
+	FixedTimestep mFixedTimestep{};
+	FramePacer mFramePacer{};
+
+	// 렌더 스레드 관련.
+	bool mThreadedRendering{};
+	TripleBuffer<FramePacket> mFramePackets{};
+	std::mutex mPacketMutex{};
+	std::condition_variable mPacketCondition{};
+	// 렌더 스레드가 아직 가져가지 않은 패킷이 있는지, 가져가기 전에 새 패킷으로 바뀐 횟수.
+	bool mPacketPending{};
+	std::uint64_t mReplacedPacketCount{};
+	// 렌더 스레드가 그린 프레임 수. 메인 스레드가 렌더 속도에 맞춰 쉴 때 쓴다.
+	std::uint64_t mRenderedPacketCount{};
+	bool mRenderThreadReady{};
+
+	// 렌더링 쪽에서만 접근하는 상태.
+	const FramePacket* mRenderPacket{};
+	GameClock::Ticks mLastRenderTicks{};
+	int mViewportWidth{};
+	int mViewportHeight{};
+	int mAppliedSwapInterval{ -1 };
+
+	FrameStats mFrameStats{};
+	// 예제의 Render() 안에서 GPU_PROFILE_SCOPE(mGpuProfiler, "이름") 으로 패스별 GPU 시간을 잴 수 있다.
+	GpuProfiler mGpuProfiler{};
+	// 예제들이 셰이더 프로그램을 받아 쓰는 캐시. 같은 소스는 한 번만 컴파일한다.
+	ShaderCache mShaderCache{};
+	std::string mShaderBinaryDirectory{ "shader_cache" };
+	ShaderHotReload mShaderHotReload{};
+	std::string mShaderHotReloadDirectory{};
+	ShaderLibrary mShaderLibrary{};
+	std::string mShaderPreloadDirectory{};
+	// 셰이더의 PerFrame / PerObject uniform block 에 연결되는 버퍼. (render/UniformBlocks.h)
+	// PerFrame 은 Render() 에서 한 번 Upload 하고, PerObject 는 그리기마다 Push 해서 BindRange 한다.
+	UniformBuffer mPerFrameUniforms{};
+	UniformRing mPerObjectUniforms{};
+	// 매 프레임 새로 만드는 버텍스(디버그 선, 파티클, UI)를 쓰는 버퍼. Render() 안에서 Allocate 해서 바로 쓴다.
+	// 버텍스 버퍼로 붙일 때는 stride 로 정렬해서 받고 offset / stride 를 base vertex 로 쓴다.
+	StreamingBuffer mStreamingVertices{};
+	// 버텍스 포맷(common/VertexLayout.h)마다 하나씩 만든 VAO. 같은 포맷의 메시들이 나눠 쓴다.
+	VertexArrayCache mVertexArrays{};
+	// 메시 버텍스/인덱스를 포맷별 큰 버퍼 하나에 모아 둔다. 예제는 MeshHandle 만 들고 Draw 한다.
+	MeshArena mMeshArena{};
+	std::string mFrameStatsCsvPath{};
+	std::string mFrameStatsJsonPath{};
+
+	std::string mProfileOutputPath{};
+
+	// 골든 이미지 테스트.
+	bool mGoldenEnabled{};
+	bool mGoldenUpdate{};
+	std::string mGoldenDirectory{};
+	int mGoldenFrame{ 60 };
+	int mGoldenTolerance{ 8 };
+	double mGoldenMaxMismatchRatio{ 0.001 };
+	bool mGoldenChecked{};
+	bool mGoldenPassed{};
+	OffscreenTarget mOffscreenTarget{};
+	PixelReadback mPixelReadback{};
 
 	std::map<int, bool> mKeyState{};
 	glm::vec2 mMousePosition{};
@@ -0,0 +1,44 @@
+#include "ExampleRegistry.h"
+
+#include <iostream>
+
+#include "ExampleBase.h"
+
+//-----------------------------------------------------------------------------
+ExampleRegistry& ExampleRegistry::Get()
+{
+	// 정적 초기화 순서 문제를 피하기 위해 처음 쓸 때 만든다.
+	static ExampleRegistry registry{};
+	return registry;
+}
+
+//-----------------------------------------------------------------------------
+bool ExampleRegistry::Register(const std::string& id, const std::string& description, Factory factory)
+{
+	if (mEntries.find(id) != mEntries.end()) {
+		std::cerr << "[ExampleRegistry] duplicated example id: " << id << std::endl;
+		return false;
+	}
+	mEntries[id] = Entry{ id, description, std::move(factory) };
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+std::unique_ptr<ExampleBase> ExampleRegistry::Create(const std::string& id) const
+{
+	auto found = mEntries.find(id);
+	if (found == mEntries.end()) {
+		return nullptr;
+	}
+	return found->second.factory();
+}
+
+//-----------------------------------------------------------------------------
+std::vector<const ExampleRegistry::Entry*> ExampleRegistry::GetEntries() const
+{
+	std::vector<const Entry*> entries{};
+	for (const auto& entry : mEntries) {
+		entries.push_back(&entry.second);
+	}
+	return entries;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class ExampleBase;
+
+// 예제들이 스스로 등록하는 목록. 명령행에서 "--example=04" 처럼 골라서 실행할 수 있게 한다.
+// 각 예제 cpp 파일에서 REGISTER_EXAMPLE("04", Example04, "설명"); 으로 등록한다.
+class ExampleRegistry
+{
+public:
+	using Factory = std::function<std::unique_ptr<ExampleBase>()>;
+
+	struct Entry
+	{
+		std::string id{};
+		std::string description{};
+		Factory factory{};
+	};
+
+	static ExampleRegistry& Get();
+
+	bool Register(const std::string& id, const std::string& description, Factory factory);
+	std::unique_ptr<ExampleBase> Create(const std::string& id) const;
+
+	// id 순서로 정렬된 목록.
+	std::vector<const Entry*> GetEntries() const;
+
+private:
+	std::map<std::string, Entry> mEntries{};
+};
+
+#define REGISTER_EXAMPLE(id, type, description) \
+	static const bool s##type##Registered = ExampleRegistry::Get().Register(id, description, \
+		[]() -> std::unique_ptr<ExampleBase> { return std::make_unique<type>(); })
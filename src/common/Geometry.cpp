@@ -0,0 +1,93 @@
+#include "common/Geometry.h"
+
+//-----------------------------------------------------------------------------
+void Geometry::CreateTriangle(std::vector<glm::vec3>& vertices, std::vector<unsigned int>& indices)
+{
+	/*
+	*          (0, 1, 0)
+	*          (index:0)
+	*              *
+	*             * *
+	*            *   *
+	*           *     *
+	*          *   +   *
+	*         * (center)*
+	*        *  (0,0,0)  *
+	*       *             *
+	*      *****************
+	* (-1,-1,0)         (1,-1,0)
+	* (index:1)         (index:2)
+	*/
+
+	// 삼각형의 버텍스 좌표들.
+	vertices.push_back(glm::vec3(0.0f, 1.0f, 0.0f));   // index: 0
+	vertices.push_back(glm::vec3(-1.0f, -1.0f, 0.0f)); // index: 1
+	vertices.push_back(glm::vec3(1.0f, -1.0f, 0.0f));  // index: 2
+	// 삼각형의 인덱스 배열.
+	indices.push_back(0);
+	indices.push_back(1);
+	indices.push_back(2);
+}
+
+//-----------------------------------------------------------------------------
+void Geometry::CreateColorTriangle(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices)
+{
+	glm::vec3 RED = glm::vec3(1, 0, 0);
+	glm::vec3 GREEN = glm::vec3(0, 1, 0);
+	glm::vec3 BLUE = glm::vec3(0, 0, 1);
+	vertices.push_back(Vertex(glm::vec3(0.0f, 1.0f, 0.0f), RED));       // center top.
+	vertices.push_back(Vertex(glm::vec3(-1.0f, -1.0f, 0.0f), GREEN));     // left bottom.
+	vertices.push_back(Vertex(glm::vec3(1.0f, -1.0f, 0.0f), BLUE));      // right bottom.
+
+	indices.push_back(0);
+	indices.push_back(1);
+	indices.push_back(2);
+}
+
+//-----------------------------------------------------------------------------
+void Geometry::CreateRectangle(UvType uvType, std::vector<VertexUV>& vertices, std::vector<unsigned int>& indices)
+{
+	glm::vec2 uvLeftTop{ 0};
+	glm::vec2 uvRightTop{ 0 };
+	glm::vec2 uvRightBottom{ 0 };
+	glm::vec2 uvLeftBottom{ 0 };
+
+	switch (uvType) {
+		case UvType::Fit:
+		// 기본 UV 좌표 사용
+			uvLeftTop = glm::vec2{ 0.0f, 1.0f };
+			uvRightTop = glm::vec2{ 1.0f, 1.0f };
+			uvRightBottom = glm::vec2{ 1.0f, 0.0f };
+			uvLeftBottom = glm::vec2{ 0.0f, 0.0f };
+			break;
+		case UvType::Smaller:
+			// UV 좌표를 0.5배 축소
+			uvLeftTop = glm::vec2{ 0.25f, 0.75f };
+			uvRightTop = glm::vec2{ 0.75f, 0.75f };
+			uvRightBottom = glm::vec2{ 0.75f, 0.25f };
+			uvLeftBottom = glm::vec2{ 0.25f, 0.25f };
+
+			break;
+		case UvType::Bigger:
+			// UV 좌표를 2배 확대
+			uvLeftTop = glm::vec2{ -0.5f, 1.5f };
+			uvRightTop = glm::vec2{ 1.5f, 1.5f };
+			uvRightBottom = glm::vec2{ 1.5f, -0.5f };
+			uvLeftBottom = glm::vec2{ -0.5f, -0.5f };
+			break;
+	}
+
+	float scale = 0.8f;
+	vertices.push_back(VertexUV(scale * glm::vec3(-1.0f, 1.0f, 0.0f), glm::vec3(1, 0, 0), uvLeftTop));     // left top
+	vertices.push_back(VertexUV(scale * glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(0, 1, 0), uvLeftBottom));    // left bottom
+	vertices.push_back(VertexUV(scale * glm::vec3(1.0f, -1.0f, 0.0f), glm::vec3(0, 0, 1), uvRightBottom));     // right bottom
+	vertices.push_back(VertexUV(scale * glm::vec3(1.0f, 1.0f, 0.0f), glm::vec3(0, 0, 1), uvRightTop));      // right top
+
+	indices.push_back(0);  // first vertex.
+	indices.push_back(1);  // second vertex.
+	indices.push_back(2);  // third vertex.
+
+	indices.push_back(0);  // first vertex.
+	indices.push_back(2);  // second vertex.
+	indices.push_back(3);  // third vertex.
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <vector>
+
+#include "glm/glm.hpp"
+#include "common/Vertex.h"
+
+// 텍스처 좌표 계산 방식.
+enum class UvType
+{
+	Fit,
+	Smaller,
+	Bigger
+};
+
+// 예제들이 쓰는 기본 도형의 버텍스/인덱스 배열을 만든다. (GL 호출 없음)
+namespace Geometry
+{
+	// 위치만 있는 삼각형.
+	void CreateTriangle(std::vector<glm::vec3>& vertices, std::vector<unsigned int>& indices);
+	// 꼭지점마다 빨강/초록/파랑 색이 있는 삼각형.
+	void CreateColorTriangle(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+	// 텍스처 좌표가 있는 사각형.
+	void CreateRectangle(UvType uvType, std::vector<VertexUV>& vertices, std::vector<unsigned int>& indices);
+}
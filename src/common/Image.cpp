@@ -0,0 +1,197 @@
+#include "common/Image.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "stb/stb_image.h"
+
+namespace {
+
+//-----------------------------------------------------------------------------
+std::uint32_t Crc32(const std::uint8_t* data, std::size_t length, std::uint32_t crc = 0)
+{
+	static std::uint32_t table[256]{};
+	static bool tableReady = false;
+	if (!tableReady) {
+		for (std::uint32_t n = 0; n < 256; ++n) {
+			std::uint32_t c = n;
+			for (int k = 0; k < 8; ++k) {
+				c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+			}
+			table[n] = c;
+		}
+		tableReady = true;
+	}
+
+	crc = ~crc;
+	for (std::size_t i = 0; i < length; ++i) {
+		crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+//-----------------------------------------------------------------------------
+void PutBigEndian32(std::vector<std::uint8_t>& out, std::uint32_t value)
+{
+	out.push_back(static_cast<std::uint8_t>(value >> 24));
+	out.push_back(static_cast<std::uint8_t>(value >> 16));
+	out.push_back(static_cast<std::uint8_t>(value >> 8));
+	out.push_back(static_cast<std::uint8_t>(value));
+}
+
+//-----------------------------------------------------------------------------
+// 청크 하나 = 길이 + 타입 + 데이터 + CRC(타입 + 데이터).
+void WriteChunk(std::ofstream& file, const char* type, const std::vector<std::uint8_t>& data)
+{
+	std::vector<std::uint8_t> chunk{};
+	chunk.reserve(data.size() + 12);
+	PutBigEndian32(chunk, static_cast<std::uint32_t>(data.size()));
+	chunk.insert(chunk.end(), type, type + 4);
+	chunk.insert(chunk.end(), data.begin(), data.end());
+	PutBigEndian32(chunk, Crc32(chunk.data() + 4, data.size() + 4));
+	file.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+void Image::Resize(int newWidth, int newHeight)
+{
+	width = newWidth;
+	height = newHeight;
+	pixels.assign(static_cast<std::size_t>(width) * height * 4, 0);
+}
+
+//-----------------------------------------------------------------------------
+bool ImageIo::LoadPng(const std::string& path, Image& image)
+{
+	// 텍스처 로딩과 달리 뒤집지 않는다. (첫 행이 맨 위)
+	// 전역 설정을 건드리면 다른 로더에 영향을 주므로 이 스레드의 설정만 바꾼다.
+	stbi_set_flip_vertically_on_load_thread(false);
+	int width = 0, height = 0, channels = 0;
+	stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 4);
+	if (data == nullptr) {
+		return false;
+	}
+
+	image.Resize(width, height);
+	std::memcpy(image.pixels.data(), data, image.pixels.size());
+	stbi_image_free(data);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool ImageIo::WritePng(const std::string& path, const Image& image)
+{
+	if (image.IsEmpty()) {
+		return false;
+	}
+
+	std::ofstream file(path, std::ios::binary);
+	if (!file) {
+		std::cerr << "[Image] failed to open " << path << std::endl;
+		return false;
+	}
+
+	static const std::uint8_t SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	file.write(reinterpret_cast<const char*>(SIGNATURE), sizeof(SIGNATURE));
+
+	// IHDR: 8비트 RGBA, 인터레이스 없음.
+	std::vector<std::uint8_t> header{};
+	PutBigEndian32(header, static_cast<std::uint32_t>(image.width));
+	PutBigEndian32(header, static_cast<std::uint32_t>(image.height));
+	header.push_back(8);	// bit depth
+	header.push_back(6);	// color type: RGBA
+	header.push_back(0);	// compression
+	header.push_back(0);	// filter
+	header.push_back(0);	// interlace
+	WriteChunk(file, "IHDR", header);
+
+	// 각 행 앞에 필터 타입(0: None)을 붙인 원본 데이터.
+	std::size_t rowBytes = static_cast<std::size_t>(image.width) * 4;
+	std::vector<std::uint8_t> raw{};
+	raw.reserve((rowBytes + 1) * image.height);
+	for (int y = 0; y < image.height; ++y) {
+		raw.push_back(0);
+		const std::uint8_t* row = image.GetRow(y);
+		raw.insert(raw.end(), row, row + rowBytes);
+	}
+
+	// zlib 스트림. 압축 없이 최대 65535 바이트짜리 stored 블록으로 나눈다.
+	std::vector<std::uint8_t> zlib{};
+	zlib.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+	zlib.push_back(0x78);
+	zlib.push_back(0x01);
+	std::size_t offset = 0;
+	do {
+		std::size_t blockSize = std::min<std::size_t>(raw.size() - offset, 65535);
+		bool lastBlock = (offset + blockSize == raw.size());
+		zlib.push_back(lastBlock ? 1 : 0);
+		zlib.push_back(static_cast<std::uint8_t>(blockSize & 0xFF));
+		zlib.push_back(static_cast<std::uint8_t>(blockSize >> 8));
+		zlib.push_back(static_cast<std::uint8_t>(~blockSize & 0xFF));
+		zlib.push_back(static_cast<std::uint8_t>((~blockSize >> 8) & 0xFF));
+		zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + blockSize);
+		offset += blockSize;
+	} while (offset < raw.size());
+
+	// Adler-32
+	std::uint32_t a = 1, b = 0;
+	for (std::uint8_t value : raw) {
+		a = (a + value) % 65521;
+		b = (b + a) % 65521;
+	}
+	PutBigEndian32(zlib, (b << 16) | a);
+
+	WriteChunk(file, "IDAT", zlib);
+	WriteChunk(file, "IEND", {});
+	return static_cast<bool>(file);
+}
+
+//-----------------------------------------------------------------------------
+ImageDiff ImageIo::Compare(const Image& actual, const Image& expected, int tolerance, Image* diffImage)
+{
+	ImageDiff diff{};
+	diff.sizeMatches = (actual.width == expected.width && actual.height == expected.height
+		&& !actual.IsEmpty() && actual.pixels.size() == expected.pixels.size());
+	if (!diff.sizeMatches) {
+		return diff;
+	}
+
+	diff.totalPixels = static_cast<std::size_t>(actual.width) * actual.height;
+	if (diffImage != nullptr) {
+		diffImage->Resize(actual.width, actual.height);
+	}
+
+	std::uint64_t errorSum = 0;
+	for (std::size_t i = 0; i < diff.totalPixels; ++i) {
+		const std::uint8_t* a = &actual.pixels[i * 4];
+		const std::uint8_t* e = &expected.pixels[i * 4];
+		int pixelMax = 0;
+		for (int c = 0; c < 4; ++c) {
+			int d = std::abs(static_cast<int>(a[c]) - static_cast<int>(e[c]));
+			errorSum += d;
+			pixelMax = std::max(pixelMax, d);
+		}
+		diff.maxChannelDifference = std::max(diff.maxChannelDifference, pixelMax);
+		bool mismatched = pixelMax > tolerance;
+		if (mismatched) {
+			++diff.mismatchedPixels;
+		}
+
+		if (diffImage != nullptr) {
+			// 맞는 픽셀은 어둡게, 틀린 픽셀은 빨갛게.
+			std::uint8_t* out = &diffImage->pixels[i * 4];
+			std::uint8_t gray = static_cast<std::uint8_t>((e[0] + e[1] + e[2]) / 12);
+			out[0] = mismatched ? 255 : gray;
+			out[1] = mismatched ? 0 : gray;
+			out[2] = mismatched ? 0 : gray;
+			out[3] = 255;
+		}
+	}
+	diff.meanAbsoluteError = static_cast<double>(errorSum) / (diff.totalPixels * 4);
+	return diff;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// RGBA8 이미지. 첫 행이 맨 위. (GL 호출 없음)
+struct Image
+{
+	int width{};
+	int height{};
+	std::vector<std::uint8_t> pixels{};
+
+	bool IsEmpty() const { return width <= 0 || height <= 0 || pixels.empty(); }
+	void Resize(int newWidth, int newHeight);
+	std::uint8_t* GetRow(int y) { return pixels.data() + static_cast<std::size_t>(y) * width * 4; }
+	const std::uint8_t* GetRow(int y) const { return pixels.data() + static_cast<std::size_t>(y) * width * 4; }
+};
+
+// 두 이미지를 비교한 결과.
+struct ImageDiff
+{
+	bool sizeMatches{};
+	// 채널 값 차이의 최대값. (0~255)
+	int maxChannelDifference{};
+	// 허용 오차를 넘는 채널이 하나라도 있는 픽셀 수.
+	std::size_t mismatchedPixels{};
+	std::size_t totalPixels{};
+	// 채널당 평균 절대 오차.
+	double meanAbsoluteError{};
+
+	double GetMismatchRatio() const { return (totalPixels > 0) ? static_cast<double>(mismatchedPixels) / totalPixels : 1.0; }
+};
+
+namespace ImageIo
+{
+	// PNG 를 RGBA8 로 읽는다.
+	bool LoadPng(const std::string& path, Image& image);
+	// RGBA8 PNG 로 저장한다. 압축은 하지 않는다. (deflate stored 블록)
+	bool WritePng(const std::string& path, const Image& image);
+
+	// 채널 차이가 tolerance 를 넘는 픽셀을 센다. diffImage 를 주면 틀린 픽셀을 빨갛게 표시한 이미지를 만든다.
+	ImageDiff Compare(const Image& actual, const Image& expected, int tolerance, Image* diffImage = nullptr);
+}
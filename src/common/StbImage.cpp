@@ -0,0 +1,4 @@
+// stb_image 구현부는 이 파일 하나에서만 만든다.
+// (예제와 벤치마크 양쪽에서 같이 쓴다)
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb/stb_image.h"
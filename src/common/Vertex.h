@@ -1,3 +1,8 @@
+#pragma once
+#include "glm/glm.hpp"
+
+#include "common/VertexLayout.h"
+
 struct Vertex{
 	glm::vec3 mPosition;
 	glm::vec3 mColor;
@@ -8,4 +13,72 @@ struct Vertex{
 		: mPosition(position), mColor(color)
 	{
 	}
-};
\ No newline at end of file
+};
+
+// 텍스처 좌표가 있는 버텍스.
+struct VertexUV {
+	glm::vec3 mPosition{ 0,0,0 };
+	glm::vec3 mColor{ 0,0,0 };
+	glm::vec2 mUv{ 0,0 };
+
+	VertexUV() {}
+	VertexUV(const glm::vec3& position, const glm::vec3& color, const glm::vec2& uv)
+		: mPosition(position), mColor(color), mUv(uv)
+	{
+	}
+};
+
+// 모델(OBJ) 버텍스. 셰이더의 position, vertex_color, normal, texture_uv 순서와 같다.
+struct ModelVertex {
+	glm::vec3 mPosition{ 0,0,0 };
+	glm::vec3 mColor{ 1,1,1 };
+	glm::vec3 mNormal{ 0,0,0 };
+	glm::vec2 mUv{ 0,0 };
+};
+
+// 버텍스 구조체들의 속성 배치. location 은 각 구조체를 쓰는 셰이더와 맞춘다.
+// 위치만 있는 버텍스. (glm::vec3 배열)
+template <> struct VertexLayout<glm::vec3>
+{
+	static constexpr VertexAttribute ATTRIBUTES[] = { VertexAttribute{ 0, 3, VertexAttributeTraits<glm::vec3>::TYPE, false, 0, sizeof(glm::vec3) } };
+	static constexpr int ATTRIBUTE_COUNT = 1;
+	static constexpr unsigned int STRIDE = static_cast<unsigned int>(sizeof(glm::vec3));
+	static const VertexFormat& GetFormat()
+	{
+		static const VertexFormat FORMAT{ ATTRIBUTES, ATTRIBUTE_COUNT, STRIDE };
+		return FORMAT;
+	}
+};
+
+DECLARE_VERTEX_LAYOUT(Vertex,
+	VERTEX_ATTRIBUTE(Vertex, mPosition, 0),
+	VERTEX_ATTRIBUTE(Vertex, mColor, 1));
+
+// Example04 / Texture.vs 는 텍스처 좌표를 location 2 로 받는다.
+DECLARE_VERTEX_LAYOUT(VertexUV,
+	VERTEX_ATTRIBUTE(VertexUV, mPosition, 0),
+	VERTEX_ATTRIBUTE(VertexUV, mColor, 1),
+	VERTEX_ATTRIBUTE(VertexUV, mUv, 2));
+
+// resources/shaders 의 속성 위치: 0 위치, 1 색상, 2 노멀, 3 텍스처 좌표.
+DECLARE_VERTEX_LAYOUT(ModelVertex,
+	VERTEX_ATTRIBUTE(ModelVertex, mPosition, 0),
+	VERTEX_ATTRIBUTE(ModelVertex, mColor, 1),
+	VERTEX_ATTRIBUTE(ModelVertex, mNormal, 2),
+	VERTEX_ATTRIBUTE(ModelVertex, mUv, 3));
+
+// 압축한 모델 버텍스. (20바이트, ModelVertex 는 44바이트)
+// 위치는 메시 경계 상자 기준 16비트 snorm 이라 그릴 때 모델 행렬에 경계 상자 변환을 곱해야 한다. (mesh/VertexQuantizer)
+// 셰이더 입력은 ModelVertex 와 같다. (정규화 정수는 float 로 풀려서 들어간다)
+struct QuantizedModelVertex {
+	Snorm16x4 mPosition{};
+	Unorm8x4 mColor{};
+	Snorm10x3 mNormal{};
+	Half2 mUv{};
+};
+
+DECLARE_VERTEX_LAYOUT(QuantizedModelVertex,
+	VERTEX_ATTRIBUTE(QuantizedModelVertex, mPosition, 0),
+	VERTEX_ATTRIBUTE(QuantizedModelVertex, mColor, 1),
+	VERTEX_ATTRIBUTE(QuantizedModelVertex, mNormal, 2),
+	VERTEX_ATTRIBUTE(QuantizedModelVertex, mUv, 3));
@@ -0,0 +1,121 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "glm/glm.hpp"
+
+// 버텍스 구조체의 속성 배치를 컴파일 시점에 적어 두는 서술자.
+// 구조체마다 DECLARE_VERTEX_LAYOUT 으로 한 번 적으면, 속성 개수/타입/오프셋은 멤버 타입과 offsetof 에서 나온다.
+// VAO 를 만드는 쪽(render/VertexArrayCache)은 이 서술자만 보고 속성 포맷을 설정한다.
+// (GL 헤더 없이 쓰려고 GL enum 값을 직접 적는다)
+
+// 속성 하나. location 은 셰이더의 layout(location = N).
+struct VertexAttribute
+{
+	unsigned int location;
+	int componentCount;
+	unsigned int type;
+	bool normalized;
+	unsigned int offset;
+	// 속성이 버텍스 안에서 차지하는 바이트 수.
+	unsigned int size;
+};
+
+// 버텍스 하나의 전체 배치.
+struct VertexFormat
+{
+	const VertexAttribute* attributes;
+	int attributeCount;
+	unsigned int stride;
+};
+
+// 배치가 같으면 (구조체가 달라도) 같은 포맷이다.
+inline bool operator==(const VertexFormat& left, const VertexFormat& right)
+{
+	if (left.attributeCount != right.attributeCount || left.stride != right.stride) {
+		return false;
+	}
+	for (int i = 0; i < left.attributeCount; ++i) {
+		const VertexAttribute& a = left.attributes[i];
+		const VertexAttribute& b = right.attributes[i];
+		if (a.location != b.location || a.componentCount != b.componentCount || a.type != b.type
+			|| a.normalized != b.normalized || a.offset != b.offset) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// 압축 버텍스 속성 타입. 셰이더에는 float 로 풀려서 들어간다.
+// 16비트 snorm 3개. (w 는 4바이트 정렬용)
+struct Snorm16x4
+{
+	std::int16_t x, y, z, w;
+};
+// GL_INT_2_10_10_10_REV. x 가 하위 10비트.
+struct Snorm10x3
+{
+	std::uint32_t packed;
+};
+// 반정밀도 float 2개.
+struct Half2
+{
+	std::uint16_t x, y;
+};
+// 8비트 unorm 4개.
+struct Unorm8x4
+{
+	std::uint8_t x, y, z, w;
+};
+
+// 멤버 타입에서 속성의 성분 수와 GL 타입, 정규화 여부를 얻는다.
+template <typename T> struct VertexAttributeTraits;
+template <> struct VertexAttributeTraits<float>		{ static constexpr int COMPONENT_COUNT = 1; static constexpr unsigned int TYPE = 0x1406; static constexpr bool NORMALIZED = false; };	// GL_FLOAT
+template <> struct VertexAttributeTraits<glm::vec2>	{ static constexpr int COMPONENT_COUNT = 2; static constexpr unsigned int TYPE = 0x1406; static constexpr bool NORMALIZED = false; };
+template <> struct VertexAttributeTraits<glm::vec3>	{ static constexpr int COMPONENT_COUNT = 3; static constexpr unsigned int TYPE = 0x1406; static constexpr bool NORMALIZED = false; };
+template <> struct VertexAttributeTraits<glm::vec4>	{ static constexpr int COMPONENT_COUNT = 4; static constexpr unsigned int TYPE = 0x1406; static constexpr bool NORMALIZED = false; };
+template <> struct VertexAttributeTraits<Snorm16x4>	{ static constexpr int COMPONENT_COUNT = 3; static constexpr unsigned int TYPE = 0x1402; static constexpr bool NORMALIZED = true; };	// GL_SHORT
+template <> struct VertexAttributeTraits<Snorm10x3>	{ static constexpr int COMPONENT_COUNT = 4; static constexpr unsigned int TYPE = 0x8D9F; static constexpr bool NORMALIZED = true; };	// GL_INT_2_10_10_10_REV
+template <> struct VertexAttributeTraits<Half2>		{ static constexpr int COMPONENT_COUNT = 2; static constexpr unsigned int TYPE = 0x140B; static constexpr bool NORMALIZED = false; };	// GL_HALF_FLOAT
+template <> struct VertexAttributeTraits<Unorm8x4>	{ static constexpr int COMPONENT_COUNT = 4; static constexpr unsigned int TYPE = 0x1401; static constexpr bool NORMALIZED = true; };	// GL_UNSIGNED_BYTE
+
+// 속성이 겹치지 않고 모두 stride 안에 들어가는지 확인한다. (static_assert 용)
+constexpr bool IsValidVertexLayout(const VertexAttribute* attributes, int count, unsigned int stride)
+{
+	for (int i = 0; i < count; ++i) {
+		unsigned int end = attributes[i].offset + attributes[i].size;
+		if (attributes[i].componentCount < 1 || attributes[i].componentCount > 4 || end > stride) {
+			return false;
+		}
+		for (int j = i + 1; j < count; ++j) {
+			if (attributes[i].location == attributes[j].location) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+// 구조체마다 특수화한다. (DECLARE_VERTEX_LAYOUT)
+template <typename T> struct VertexLayout;
+
+// 멤버 하나를 속성으로 적는다.
+#define VERTEX_ATTRIBUTE(VertexType, member, location) \
+	VertexAttribute{ (location), VertexAttributeTraits<decltype(VertexType::member)>::COMPONENT_COUNT, \
+		VertexAttributeTraits<decltype(VertexType::member)>::TYPE, VertexAttributeTraits<decltype(VertexType::member)>::NORMALIZED, \
+		static_cast<unsigned int>(offsetof(VertexType, member)), static_cast<unsigned int>(sizeof(VertexType::member)) }
+
+// VertexType 의 배치를 정의한다. 인자는 VERTEX_ATTRIBUTE(...) 목록.
+#define DECLARE_VERTEX_LAYOUT(VertexType, ...) \
+	template <> struct VertexLayout<VertexType> \
+	{ \
+		static constexpr VertexAttribute ATTRIBUTES[] = { __VA_ARGS__ }; \
+		static constexpr int ATTRIBUTE_COUNT = static_cast<int>(sizeof(ATTRIBUTES) / sizeof(ATTRIBUTES[0])); \
+		static constexpr unsigned int STRIDE = static_cast<unsigned int>(sizeof(VertexType)); \
+		static_assert(IsValidVertexLayout(ATTRIBUTES, ATTRIBUTE_COUNT, STRIDE), "invalid vertex layout for " #VertexType); \
+		static const VertexFormat& GetFormat() \
+		{ \
+			static const VertexFormat FORMAT{ ATTRIBUTES, ATTRIBUTE_COUNT, STRIDE }; \
+			return FORMAT; \
+		} \
+	}
@@ -0,0 +1,65 @@
+#include "core/CommandLine.h"
+
+#include <cstdlib>
+
+//-----------------------------------------------------------------------------
+CommandLine::CommandLine(int argc, char** argv)
+{
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg.rfind("--", 0) != 0) {
+			mPositionals.push_back(arg);
+			continue;
+		}
+
+		// "--key=value" 는 값과 함께, "--flag" 는 빈 값으로 저장한다.
+		std::string::size_type equal = arg.find('=');
+		if (equal == std::string::npos) {
+			mOptions[arg.substr(2)] = "";
+		}
+		else {
+			mOptions[arg.substr(2, equal - 2)] = arg.substr(equal + 1);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool CommandLine::Has(const std::string& key) const
+{
+	mUsed.insert(key);
+	return mOptions.find(key) != mOptions.end();
+}
+
+//-----------------------------------------------------------------------------
+std::string CommandLine::GetString(const std::string& key, const std::string& defaultValue) const
+{
+	mUsed.insert(key);
+	auto found = mOptions.find(key);
+	return (found != mOptions.end()) ? found->second : defaultValue;
+}
+
+//-----------------------------------------------------------------------------
+int CommandLine::GetInt(const std::string& key, int defaultValue) const
+{
+	std::string value = GetString(key);
+	return value.empty() ? defaultValue : std::atoi(value.c_str());
+}
+
+//-----------------------------------------------------------------------------
+double CommandLine::GetDouble(const std::string& key, double defaultValue) const
+{
+	std::string value = GetString(key);
+	return value.empty() ? defaultValue : std::atof(value.c_str());
+}
+
+//-----------------------------------------------------------------------------
+std::vector<std::string> CommandLine::GetUnusedOptions() const
+{
+	std::vector<std::string> unused{};
+	for (const auto& option : mOptions) {
+		if (mUsed.find(option.first) == mUsed.end()) {
+			unused.push_back(option.first);
+		}
+	}
+	return unused;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// "--key=value" 와 "--flag" 형태의 명령행 인자를 읽는 클래스.
+class CommandLine
+{
+public:
+	CommandLine() = default;
+	CommandLine(int argc, char** argv);
+
+	bool Has(const std::string& key) const;
+	std::string GetString(const std::string& key, const std::string& defaultValue = "") const;
+	int GetInt(const std::string& key, int defaultValue = 0) const;
+	double GetDouble(const std::string& key, double defaultValue = 0.0) const;
+
+	// 한 번도 조회되지 않은 옵션들. 오타 난 옵션을 알려주는데 쓴다.
+	std::vector<std::string> GetUnusedOptions() const;
+	// "--" 로 시작하지 않는 인자들.
+	const std::vector<std::string>& GetPositionals() const { return mPositionals; }
+
+private:
+	std::map<std::string, std::string> mOptions{};
+	std::vector<std::string> mPositionals{};
+	mutable std::set<std::string> mUsed{};
+};
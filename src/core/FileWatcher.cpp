@@ -0,0 +1,140 @@
+#include "core/FileWatcher.h"
+
+#include <algorithm>
+#include <iostream>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+// 수정 시각 비교 간격.
+static constexpr std::chrono::milliseconds SCAN_INTERVAL{ 250 };
+
+//-----------------------------------------------------------------------------
+FileWatcher::FileWatcher()
+{
+}
+
+//-----------------------------------------------------------------------------
+FileWatcher::~FileWatcher()
+{
+	Stop();
+}
+
+//-----------------------------------------------------------------------------
+bool FileWatcher::Watch(const std::string& directory)
+{
+	Stop();
+
+	std::error_code error{};
+	mDirectory = fs::absolute(directory, error).lexically_normal();
+	if (error || !fs::is_directory(mDirectory)) {
+		std::cerr << "[FileWatcher] not a directory: " << directory << std::endl;
+		return false;
+	}
+
+#if defined(__linux__)
+	mInotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (mInotifyFd >= 0) {
+		mWatchDescriptor = inotify_add_watch(mInotifyFd, mDirectory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+		if (mWatchDescriptor < 0) {
+			close(mInotifyFd);
+			mInotifyFd = -1;
+		}
+	}
+#endif
+
+	if (mInotifyFd < 0) {
+		// inotify 를 못 쓰면 수정 시각을 기억해 두고 비교한다.
+		ScanModificationTimes(nullptr);
+		mLastScan = std::chrono::steady_clock::now();
+	}
+	mWatching = true;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void FileWatcher::Stop()
+{
+#if defined(__linux__)
+	if (mInotifyFd >= 0) {
+		if (mWatchDescriptor >= 0) {
+			inotify_rm_watch(mInotifyFd, mWatchDescriptor);
+		}
+		close(mInotifyFd);
+	}
+#endif
+	mInotifyFd = -1;
+	mWatchDescriptor = -1;
+	mModificationTimes.clear();
+	mWatching = false;
+}
+
+//-----------------------------------------------------------------------------
+std::vector<std::string> FileWatcher::Poll()
+{
+	std::vector<std::string> changed{};
+	if (!mWatching) {
+		return changed;
+	}
+
+#if defined(__linux__)
+	if (mInotifyFd >= 0) {
+		alignas(inotify_event) char buffer[4096];
+		while (true) {
+			ssize_t length = read(mInotifyFd, buffer, sizeof(buffer));
+			if (length <= 0) {
+				// EAGAIN: 더 읽을 이벤트가 없다.
+				break;
+			}
+			for (ssize_t offset = 0; offset < length;) {
+				const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+				if (event->len > 0 && (event->mask & IN_ISDIR) == 0) {
+					changed.push_back((mDirectory / event->name).string());
+				}
+				offset += sizeof(inotify_event) + event->len;
+			}
+		}
+	}
+#endif
+
+	if (mInotifyFd < 0) {
+		auto now = std::chrono::steady_clock::now();
+		if (now - mLastScan >= SCAN_INTERVAL) {
+			mLastScan = now;
+			ScanModificationTimes(&changed);
+		}
+	}
+
+	// 저장 한 번에 이벤트가 여러 개 올 수 있으므로 중복을 없앤다.
+	std::sort(changed.begin(), changed.end());
+	changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+	return changed;
+}
+
+//-----------------------------------------------------------------------------
+void FileWatcher::ScanModificationTimes(std::vector<std::string>* changed)
+{
+	std::error_code error{};
+	for (const fs::directory_entry& entry : fs::directory_iterator(mDirectory, error)) {
+		if (!entry.is_regular_file(error)) {
+			continue;
+		}
+		fs::file_time_type time = entry.last_write_time(error);
+		if (error) {
+			continue;
+		}
+		std::string path = entry.path().string();
+		auto found = mModificationTimes.find(path);
+		if (found == mModificationTimes.end() || found->second != time) {
+			mModificationTimes[path] = time;
+			if (changed != nullptr) {
+				changed->push_back(path);
+			}
+		}
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+// 폴더 하나의 파일 변경을 감시한다. (하위 폴더는 보지 않는다)
+// Linux 에서는 inotify 로 쓰기가 끝난(IN_CLOSE_WRITE) 파일과 이름이 바뀌어 들어온(IN_MOVED_TO) 파일을 받고,
+// 다른 플랫폼에서는 일정 간격으로 수정 시각을 비교한다. Poll() 은 기다리지 않는다.
+class FileWatcher
+{
+public:
+	FileWatcher();
+	~FileWatcher();
+
+	FileWatcher(const FileWatcher&) = delete;
+	FileWatcher& operator=(const FileWatcher&) = delete;
+
+	bool Watch(const std::string& directory);
+	void Stop();
+
+	// 지난 호출 이후 바뀐 파일의 절대 경로들. (중복 없음)
+	std::vector<std::string> Poll();
+
+	bool IsWatching() const { return mWatching; }
+	// inotify 를 못 쓰고 수정 시각 비교로 감시 중이면 true.
+	bool IsPolling() const { return mWatching && mInotifyFd < 0; }
+
+private:
+	void ScanModificationTimes(std::vector<std::string>* changed);
+
+private:
+	bool mWatching{};
+	std::filesystem::path mDirectory{};
+	int mInotifyFd{ -1 };
+	int mWatchDescriptor{ -1 };
+
+	// 수정 시각 비교용.
+	std::map<std::string, std::filesystem::file_time_type> mModificationTimes{};
+	std::chrono::steady_clock::time_point mLastScan{};
+};
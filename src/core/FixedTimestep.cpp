@@ -0,0 +1,56 @@
+#include "core/FixedTimestep.h"
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+FixedTimestep::FixedTimestep()
+{
+	SetStepRate(mStepRate);
+}
+
+//-----------------------------------------------------------------------------
+void FixedTimestep::SetStepRate(double hz)
+{
+	mStepRate = std::max(hz, 1.0);
+	mStepTicks = std::max<GameClock::Ticks>(GameClock::FromSeconds(1.0 / mStepRate), 1);
+}
+
+//-----------------------------------------------------------------------------
+void FixedTimestep::SetMaxStepsPerFrame(int maxSteps)
+{
+	mMaxStepsPerFrame = std::max(maxSteps, 1);
+}
+
+//-----------------------------------------------------------------------------
+void FixedTimestep::Reset()
+{
+	mAccumulator = 0;
+	mStepCount = 0;
+	mDroppedTicks = 0;
+}
+
+//-----------------------------------------------------------------------------
+int FixedTimestep::Advance(GameClock::Ticks frameDelta)
+{
+	mAccumulator += std::max<GameClock::Ticks>(frameDelta, 0);
+
+	GameClock::Ticks steps = mAccumulator / mStepTicks;
+	if (steps > mMaxStepsPerFrame) {
+		// 너무 밀렸으면 상한만큼만 돌리고 나머지는 버린다.
+		// 남은 시간을 계속 들고 있으면 다음 프레임이 더 느려지는 악순환이 생긴다.
+		GameClock::Ticks kept = mMaxStepsPerFrame * mStepTicks + (mAccumulator % mStepTicks);
+		mDroppedTicks += mAccumulator - kept;
+		mAccumulator = kept;
+		steps = mMaxStepsPerFrame;
+	}
+
+	mAccumulator -= steps * mStepTicks;
+	mStepCount += steps;
+	return static_cast<int>(steps);
+}
+
+//-----------------------------------------------------------------------------
+float FixedTimestep::GetAlpha() const
+{
+	return static_cast<float>(static_cast<double>(mAccumulator) / static_cast<double>(mStepTicks));
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "core/GameClock.h"
+
+// 고정 간격 시뮬레이션 스텝 계산기.
+// 렌더링 속도와 상관없이 정해진 간격(예: 120Hz)으로 Update 를 몇 번 돌려야 하는지 알려주고,
+// 남은 시간을 렌더링 보간 계수(alpha)로 돌려준다.
+class FixedTimestep
+{
+public:
+	FixedTimestep();
+
+	void SetStepRate(double hz);
+	double GetStepRate() const { return mStepRate; }
+
+	// 한 프레임에 최대로 따라잡을 스텝 수. 넘치는 시간은 버린다. (spiral of death 방지)
+	void SetMaxStepsPerFrame(int maxSteps);
+
+	void Reset();
+
+	// 지난 프레임 이후 흐른 시간을 누적하고, 이번 프레임에 실행할 스텝 수를 돌려준다.
+	int Advance(GameClock::Ticks frameDelta);
+
+	GameClock::Ticks GetStepTicks() const { return mStepTicks; }
+	double GetStepSeconds() const { return GameClock::ToSeconds(mStepTicks); }
+
+	// 다음 스텝까지 진행된 비율 [0, 1). 이전 상태와 현재 상태를 보간하는데 쓴다.
+	float GetAlpha() const;
+
+	// 지금까지 실행한 스텝 수와 시뮬레이션 시간.
+	std::int64_t GetStepCount() const { return mStepCount; }
+	double GetSimulationTime() const { return GameClock::ToSeconds(mStepCount * mStepTicks); }
+
+	// 스텝 상한 때문에 버린 누적 시간(틱).
+	GameClock::Ticks GetDroppedTicks() const { return mDroppedTicks; }
+
+private:
+	double mStepRate{ 120.0 };
+	GameClock::Ticks mStepTicks{};
+	int mMaxStepsPerFrame{ 8 };
+
+	GameClock::Ticks mAccumulator{};
+	std::int64_t mStepCount{};
+	GameClock::Ticks mDroppedTicks{};
+};
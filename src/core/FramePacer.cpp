@@ -0,0 +1,83 @@
+#include "core/FramePacer.h"
+
+#include <algorithm>
+#include <thread>
+
+//-----------------------------------------------------------------------------
+FramePacer::FramePacer()
+{
+	SetTargetFps(mTargetFps);
+	SetSpinThreshold(std::chrono::microseconds(2000));
+}
+
+//-----------------------------------------------------------------------------
+void FramePacer::SetMode(FramePaceMode mode)
+{
+	mMode = mode;
+	mNextDeadline = Clock::time_point{};
+}
+
+//-----------------------------------------------------------------------------
+void FramePacer::SetTargetFps(double fps)
+{
+	mTargetFps = std::max(fps, 1.0);
+	mFrameBudget = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / mTargetFps));
+	mNextDeadline = Clock::time_point{};
+}
+
+//-----------------------------------------------------------------------------
+void FramePacer::SetSpinThreshold(std::chrono::microseconds threshold)
+{
+	mSpinThreshold = std::chrono::duration_cast<Clock::duration>(threshold);
+}
+
+//-----------------------------------------------------------------------------
+int FramePacer::GetSwapInterval() const
+{
+	return (mMode == FramePaceMode::VSync) ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+void FramePacer::BeginFrame()
+{
+	mFrameStart = Clock::now();
+	if (mNextDeadline == Clock::time_point{}) {
+		mNextDeadline = mFrameStart + mFrameBudget;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FramePacer::EndFrame()
+{
+	Clock::time_point workEnd = Clock::now();
+	mLastWorkTime = std::chrono::duration<double>(workEnd - mFrameStart).count();
+	mLastWaitTime = 0.0;
+
+	// VSync 는 SwapBuffers 가, Uncapped 는 아무도 기다리지 않는다.
+	if (mMode != FramePaceMode::FixedTarget) {
+		return;
+	}
+
+	Clock::time_point deadline = mNextDeadline;
+	if (workEnd < deadline) {
+		// 남은 시간 중 spin 구간을 뺀 만큼만 재운다. (sleep 은 늦게 깨어날 수 있다)
+		Clock::duration remaining = deadline - workEnd;
+		if (remaining > mSpinThreshold) {
+			std::this_thread::sleep_for(remaining - mSpinThreshold);
+		}
+		// 마지막 구간은 spin-wait 으로 정확하게 맞춘다.
+		while (Clock::now() < deadline) {
+			std::this_thread::yield();
+		}
+	}
+
+	Clock::time_point now = Clock::now();
+	mLastWaitTime = std::chrono::duration<double>(now - workEnd).count();
+
+	// 다음 마감 시간은 이전 마감 시간 기준으로 잡아서 평균 프레임 속도가 흔들리지 않게 한다.
+	// 한 프레임 이상 밀렸으면 따라잡으려고 연속으로 달리지 않도록 현재 시각 기준으로 다시 맞춘다.
+	mNextDeadline = deadline + mFrameBudget;
+	if (mNextDeadline < now) {
+		mNextDeadline = now + mFrameBudget;
+	}
+}
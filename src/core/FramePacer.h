@@ -0,0 +1,54 @@
+#pragma once
+#include <chrono>
+
+// 프레임 속도 조절 방식.
+enum class FramePaceMode
+{
+	VSync,			// 모니터 수직동기에 맞춘다. (glfwSwapInterval(1))
+	FixedTarget,	// 지정한 목표 FPS에 맞춰 남은 시간만큼 쉰다.
+	Uncapped		// 제한 없이 최대한 빨리 돈다. (벤치마크용)
+};
+
+// 프레임 작업 시간을 측정해서, 목표 프레임 시간 중 남은 시간만큼만 쉬게 해주는 클래스.
+// 마지막 구간은 sleep 대신 spin-wait 으로 기다려서 OS 스케줄러 오차를 줄인다.
+class FramePacer
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	FramePacer();
+
+	void SetMode(FramePaceMode mode);
+	FramePaceMode GetMode() const { return mMode; }
+
+	void SetTargetFps(double fps);
+	double GetTargetFps() const { return mTargetFps; }
+
+	// sleep 을 멈추고 spin-wait 으로 전환할 남은 시간.
+	void SetSpinThreshold(std::chrono::microseconds threshold);
+
+	// 현재 모드에 맞는 glfwSwapInterval 값.
+	int GetSwapInterval() const;
+
+	// 프레임 작업 시작 시점에 호출한다.
+	void BeginFrame();
+	// 프레임 작업이 끝난 뒤 호출한다. FixedTarget 모드에서는 남은 시간만큼 기다린다.
+	void EndFrame();
+
+	// 마지막 프레임에서 실제 작업에 걸린 시간(초).
+	double GetLastWorkTime() const { return mLastWorkTime; }
+	// 마지막 프레임에서 기다린 시간(초).
+	double GetLastWaitTime() const { return mLastWaitTime; }
+
+private:
+	FramePaceMode mMode{ FramePaceMode::VSync };
+	double mTargetFps{ 60.0 };
+	Clock::duration mFrameBudget{};
+	Clock::duration mSpinThreshold{};
+
+	Clock::time_point mFrameStart{};
+	Clock::time_point mNextDeadline{};
+
+	double mLastWorkTime{};
+	double mLastWaitTime{};
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+// 시뮬레이션(메인) 스레드가 한 프레임을 렌더링하는데 필요한 값을 담아 렌더 스레드로 넘기는 패킷.
+// 렌더 스레드는 받은 패킷을 읽기만 한다.
+struct FramePacket
+{
+	std::int64_t frameIndex{};
+
+	// 이전 Update 와 다음 Update 사이의 보간 계수와 시뮬레이션 시간.
+	float alpha{};
+	double simulationTime{};
+	double deltaTime{};
+
+	// 렌더링할 프레임버퍼 크기와 적용할 swap interval.
+	int framebufferWidth{};
+	int framebufferHeight{};
+	int swapInterval{ 1 };
+
+	// 시뮬레이션 스레드에서 잰 구간 시간(밀리초). 렌더 스레드에서 프레임 통계에 합친다.
+	double updateMs{};
+	double pollMs{};
+
+	// 예제가 ExampleBase::WriteRenderState 에서 채우는 렌더 상태. (오브젝트 변환, 예제별 값)
+	// Render() 는 Update() 가 바꾸는 멤버 대신 이 값을 읽는다.
+	std::vector<glm::mat4> transforms{};
+	std::vector<float> parameters{};
+
+	// 칸을 다시 쓰기 전에 값을 지운다. 벡터 용량은 남겨서 매 프레임 할당하지 않는다.
+	void Reset()
+	{
+		std::vector<glm::mat4> keptTransforms = std::move(transforms);
+		std::vector<float> keptParameters = std::move(parameters);
+		*this = FramePacket{};
+		transforms = std::move(keptTransforms);
+		parameters = std::move(keptParameters);
+		transforms.clear();
+		parameters.clear();
+	}
+};
@@ -0,0 +1,256 @@
+#include "core/FrameStats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+//-----------------------------------------------------------------------------
+FrameStats::FrameStats()
+{
+	Reset();
+}
+
+//-----------------------------------------------------------------------------
+void FrameStats::Reset()
+{
+	mHistory.assign(HISTORY_SIZE, FrameTiming{});
+	mHistoryHead = 0;
+	mFrameCount = 0;
+
+	for (PhaseHistogram& histogram : mPhases) {
+		histogram.buckets.assign(BUCKET_COUNT, 0);
+		histogram.count = 0;
+		histogram.overflowCount = 0;
+		histogram.sum = 0.0;
+		histogram.max = 0.0;
+	}
+	mGpuZones.clear();
+}
+
+//-----------------------------------------------------------------------------
+void FrameStats::Record(const FrameTiming& timing)
+{
+	// 링버퍼에 원본 기록. 가득 차면 가장 오래된 프레임을 덮어쓴다.
+	mHistory[mHistoryHead] = timing;
+	mHistoryHead = (mHistoryHead + 1) % HISTORY_SIZE;
+	++mFrameCount;
+
+	// 구간별 히스토그램에 누적. GPU 시간은 나중에 RecordGpuFrame 으로 들어온다.
+	for (int i = 0; i < static_cast<int>(FramePhase::Count); ++i) {
+		FramePhase phase = static_cast<FramePhase>(i);
+		if (phase != FramePhase::Gpu) {
+			AddToHistogram(phase, GetPhaseValue(timing, phase));
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void FrameStats::RecordGpuFrame(std::int64_t frameIndex, double gpuMs)
+{
+	// 링버퍼에 아직 남아있는 프레임이면 원본 기록에도 채워 넣는다.
+	FrameTiming& timing = mHistory[static_cast<std::size_t>(frameIndex) % HISTORY_SIZE];
+	if (frameIndex < mFrameCount && timing.frameIndex == frameIndex) {
+		timing.gpuMs = gpuMs;
+	}
+	AddToHistogram(FramePhase::Gpu, gpuMs);
+}
+
+//-----------------------------------------------------------------------------
+void FrameStats::RecordGpuZone(const char* name, double milliseconds)
+{
+	ZoneSummary& zone = mGpuZones[name];
+	++zone.count;
+	zone.sum += milliseconds;
+	zone.max = std::max(zone.max, milliseconds);
+}
+
+//-----------------------------------------------------------------------------
+void FrameStats::AddToHistogram(FramePhase phase, double value)
+{
+	PhaseHistogram& histogram = mPhases[static_cast<int>(phase)];
+	value = std::max(value, 0.0);
+
+	std::size_t bucket = static_cast<std::size_t>(value / BUCKET_WIDTH_MS);
+	if (bucket < BUCKET_COUNT) {
+		++histogram.buckets[bucket];
+	}
+	else {
+		++histogram.overflowCount;
+	}
+	++histogram.count;
+	histogram.sum += value;
+	histogram.max = std::max(histogram.max, value);
+}
+
+//-----------------------------------------------------------------------------
+double FrameStats::GetPercentile(FramePhase phase, double p) const
+{
+	const PhaseHistogram& histogram = mPhases[static_cast<int>(phase)];
+	if (histogram.count == 0) {
+		return 0.0;
+	}
+
+	// p 백분위에 해당하는 순번(1부터)을 구한 뒤 누적 개수가 그 순번을 넘는 칸을 찾는다.
+	double clamped = std::min(std::max(p, 0.0), 100.0);
+	std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(histogram.count)));
+	rank = std::max<std::uint64_t>(rank, 1);
+
+	std::uint64_t cumulative = 0;
+	for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+		cumulative += histogram.buckets[i];
+		if (cumulative >= rank) {
+			// 칸의 위쪽 경계를 돌려준다. 실제 최대값보다 커지지는 않게 한다.
+			return std::min((i + 1) * BUCKET_WIDTH_MS, histogram.max);
+		}
+	}
+	// 히스토그램 범위를 넘어선 값들 사이에 있으면 알 수 있는 건 최대값 뿐이다.
+	return histogram.max;
+}
+
+//-----------------------------------------------------------------------------
+double FrameStats::GetMean(FramePhase phase) const
+{
+	const PhaseHistogram& histogram = mPhases[static_cast<int>(phase)];
+	if (histogram.count == 0) {
+		return 0.0;
+	}
+	return histogram.sum / static_cast<double>(histogram.count);
+}
+
+//-----------------------------------------------------------------------------
+double FrameStats::GetMax(FramePhase phase) const
+{
+	return mPhases[static_cast<int>(phase)].max;
+}
+
+//-----------------------------------------------------------------------------
+std::vector<FrameTiming> FrameStats::GetHistory() const
+{
+	std::vector<FrameTiming> history{};
+	std::size_t count = static_cast<std::size_t>(std::min<std::int64_t>(mFrameCount, HISTORY_SIZE));
+	history.reserve(count);
+
+	// 링버퍼가 한 바퀴 돌았으면 head 위치가 가장 오래된 프레임이다.
+	std::size_t start = (static_cast<std::size_t>(mFrameCount) > HISTORY_SIZE) ? mHistoryHead : 0;
+	for (std::size_t i = 0; i < count; ++i) {
+		history.push_back(mHistory[(start + i) % HISTORY_SIZE]);
+	}
+	return history;
+}
+
+//-----------------------------------------------------------------------------
+bool FrameStats::WriteCsv(const std::string& path) const
+{
+	std::ofstream file(path);
+	if (!file) {
+		std::cerr << "[FrameStats] failed to open " << path << std::endl;
+		return false;
+	}
+
+	file << "frame,update_ms,render_ms,swap_ms,poll_ms,total_ms,gpu_ms\n";
+	file << std::fixed << std::setprecision(4);
+	for (const FrameTiming& timing : GetHistory()) {
+		file << timing.frameIndex << ','
+			<< timing.updateMs << ','
+			<< timing.renderMs << ','
+			<< timing.swapMs << ','
+			<< timing.pollMs << ','
+			<< timing.totalMs << ','
+			<< timing.gpuMs << '\n';
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool FrameStats::WriteJson(const std::string& path, const std::string& title) const
+{
+	std::ofstream file(path);
+	if (!file) {
+		std::cerr << "[FrameStats] failed to open " << path << std::endl;
+		return false;
+	}
+
+	file << std::fixed << std::setprecision(4);
+	file << "{\n";
+	file << "  \"title\": \"" << title << "\",\n";
+	file << "  \"frames\": " << mFrameCount << ",\n";
+	file << "  \"phases\": {\n";
+	for (int i = 0; i < static_cast<int>(FramePhase::Count); ++i) {
+		FramePhase phase = static_cast<FramePhase>(i);
+		file << "    \"" << GetPhaseName(phase) << "\": { "
+			<< "\"mean\": " << GetMean(phase) << ", "
+			<< "\"p50\": " << GetPercentile(phase, 50.0) << ", "
+			<< "\"p95\": " << GetPercentile(phase, 95.0) << ", "
+			<< "\"p99\": " << GetPercentile(phase, 99.0) << ", "
+			<< "\"max\": " << GetMax(phase) << " }"
+			<< ((i + 1 < static_cast<int>(FramePhase::Count)) ? ",\n" : "\n");
+	}
+	file << "  },\n";
+
+	// 패스별 GPU 시간.
+	file << "  \"gpu_zones\": {\n";
+	std::size_t zoneIndex = 0;
+	for (const auto& [name, zone] : mGpuZones) {
+		file << "    \"" << name << "\": { "
+			<< "\"mean\": " << zone.sum / static_cast<double>(zone.count) << ", "
+			<< "\"max\": " << zone.max << ", "
+			<< "\"count\": " << zone.count << " }"
+			<< ((++zoneIndex < mGpuZones.size()) ? ",\n" : "\n");
+	}
+	file << "  }\n";
+	file << "}\n";
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void FrameStats::PrintSummary(std::ostream& os) const
+{
+	os << "[FrameStats] frames: " << mFrameCount << " (ms: mean / p50 / p95 / p99 / max)" << std::endl;
+	os << std::fixed << std::setprecision(3);
+	for (int i = 0; i < static_cast<int>(FramePhase::Count); ++i) {
+		FramePhase phase = static_cast<FramePhase>(i);
+		os << "  " << std::setw(7) << std::left << GetPhaseName(phase) << std::right
+			<< GetMean(phase) << " / "
+			<< GetPercentile(phase, 50.0) << " / "
+			<< GetPercentile(phase, 95.0) << " / "
+			<< GetPercentile(phase, 99.0) << " / "
+			<< GetMax(phase) << std::endl;
+	}
+	if (!mGpuZones.empty()) {
+		os << "[FrameStats] gpu zones (ms: mean / max)" << std::endl;
+		for (const auto& [name, zone] : mGpuZones) {
+			os << "  " << name << " " << zone.sum / static_cast<double>(zone.count) << " / " << zone.max << std::endl;
+		}
+	}
+	os << std::defaultfloat;
+}
+
+//-----------------------------------------------------------------------------
+const char* FrameStats::GetPhaseName(FramePhase phase)
+{
+	switch (phase) {
+	case FramePhase::Update: return "update";
+	case FramePhase::Render: return "render";
+	case FramePhase::Swap: return "swap";
+	case FramePhase::Poll: return "poll";
+	case FramePhase::Total: return "total";
+	case FramePhase::Gpu: return "gpu";
+	default: return "unknown";
+	}
+}
+
+//-----------------------------------------------------------------------------
+double FrameStats::GetPhaseValue(const FrameTiming& timing, FramePhase phase)
+{
+	switch (phase) {
+	case FramePhase::Update: return timing.updateMs;
+	case FramePhase::Render: return timing.renderMs;
+	case FramePhase::Swap: return timing.swapMs;
+	case FramePhase::Poll: return timing.pollMs;
+	case FramePhase::Total: return timing.totalMs;
+	case FramePhase::Gpu: return timing.gpuMs;
+	default: return 0.0;
+	}
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// 프레임 한 장을 구간별로 나눈 시간(밀리초).
+struct FrameTiming
+{
+	std::int64_t frameIndex{};
+	double updateMs{};
+	double renderMs{};
+	double swapMs{};
+	double pollMs{};
+	double totalMs{};
+	// GPU 에서 걸린 시간. 타이머 쿼리 결과는 몇 프레임 늦게 나오므로 나중에 채워진다.
+	double gpuMs{};
+};
+
+// 통계를 따로 모으는 구간.
+enum class FramePhase
+{
+	Update,
+	Render,
+	Swap,
+	Poll,
+	Total,
+	Gpu,
+	Count
+};
+
+// 프레임 시간 기록기.
+// 최근 프레임들은 고정 크기 링버퍼에 원본 그대로 남기고(CSV 출력용),
+// 전체 실행 구간의 분포는 구간별 히스토그램에 누적해서 p50/p95/p99/max 를 바로 구할 수 있게 한다.
+class FrameStats
+{
+public:
+	// 링버퍼에 보관할 최근 프레임 수.
+	static constexpr std::size_t HISTORY_SIZE = 4096;
+	// 히스토그램 칸 하나의 폭(밀리초)과 칸 수. 이 범위를 넘는 값은 max 로만 기록된다.
+	static constexpr double BUCKET_WIDTH_MS = 0.01;
+	static constexpr std::size_t BUCKET_COUNT = 10000;
+
+	FrameStats();
+
+	void Reset();
+	void Record(const FrameTiming& timing);
+	// 이미 기록된 프레임의 GPU 시간을 채운다.
+	void RecordGpuFrame(std::int64_t frameIndex, double gpuMs);
+	// 이름 붙은 GPU 구간(패스) 시간을 누적한다.
+	void RecordGpuZone(const char* name, double milliseconds);
+
+	std::int64_t GetFrameCount() const { return mFrameCount; }
+
+	// p 는 [0, 100] 범위의 백분위.
+	double GetPercentile(FramePhase phase, double p) const;
+	double GetMean(FramePhase phase) const;
+	double GetMax(FramePhase phase) const;
+
+	// 링버퍼에 남아 있는 프레임들을 오래된 순서대로 돌려준다.
+	std::vector<FrameTiming> GetHistory() const;
+
+	bool WriteCsv(const std::string& path) const;
+	bool WriteJson(const std::string& path, const std::string& title) const;
+	void PrintSummary(std::ostream& os) const;
+
+	static const char* GetPhaseName(FramePhase phase);
+
+private:
+	struct PhaseHistogram
+	{
+		std::vector<std::uint32_t> buckets{};
+		std::uint64_t count{};
+		std::uint64_t overflowCount{};
+		double sum{};
+		double max{};
+	};
+
+	struct ZoneSummary
+	{
+		std::uint64_t count{};
+		double sum{};
+		double max{};
+	};
+
+	static double GetPhaseValue(const FrameTiming& timing, FramePhase phase);
+	void AddToHistogram(FramePhase phase, double value);
+
+private:
+	std::vector<FrameTiming> mHistory{};
+	std::size_t mHistoryHead{};
+	std::int64_t mFrameCount{};
+
+	PhaseHistogram mPhases[static_cast<int>(FramePhase::Count)]{};
+	std::map<std::string, ZoneSummary> mGpuZones{};
+};
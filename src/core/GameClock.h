@@ -0,0 +1,32 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+// 64비트 정수(나노초) 단위의 단조 증가 시계.
+// float 로 누적한 시간은 오래 켜두면 밀리초 이하 정밀도를 잃기 때문에 정수 틱으로 보관한다.
+class GameClock
+{
+public:
+	using Ticks = std::int64_t;
+	static constexpr Ticks TICKS_PER_SECOND = 1000000000;
+
+	GameClock() { Reset(); }
+
+	void Reset() { mStart = std::chrono::steady_clock::now(); }
+
+	// Reset() 이후 흐른 시간(틱).
+	Ticks Now() const {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mStart).count();
+	}
+
+	static double ToSeconds(Ticks ticks) {
+		return static_cast<double>(ticks) / static_cast<double>(TICKS_PER_SECOND);
+	}
+
+	static Ticks FromSeconds(double seconds) {
+		return static_cast<Ticks>(seconds * static_cast<double>(TICKS_PER_SECOND));
+	}
+
+private:
+	std::chrono::steady_clock::time_point mStart{};
+};
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// FNV-1a 64비트 해시. 셰이더 소스처럼 내용으로 캐시 키를 만들 때 쓴다.
+namespace Hash
+{
+	constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+	constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+
+	inline std::uint64_t Fnv1a64(const void* data, std::size_t length, std::uint64_t hash = FNV_OFFSET_BASIS)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (std::size_t i = 0; i < length; ++i) {
+			hash ^= bytes[i];
+			hash *= FNV_PRIME;
+		}
+		return hash;
+	}
+
+	inline std::uint64_t Fnv1a64(const std::string& text, std::uint64_t hash = FNV_OFFSET_BASIS)
+	{
+		return Fnv1a64(text.data(), text.size(), hash);
+	}
+}
@@ -0,0 +1,164 @@
+#include "core/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+struct ProfileEvent
+{
+	const char* name{};
+	std::int64_t startNs{};
+	std::int64_t endNs{};
+};
+
+// 스레드 하나가 쓰는 이벤트 링버퍼. 쓰는 쪽은 소유 스레드 하나뿐이다.
+struct ThreadBuffer
+{
+	std::uint32_t threadId{};
+	std::string threadName{};
+	std::vector<ProfileEvent> events{};
+	std::size_t head{};
+	std::uint64_t count{};
+};
+
+struct ProfilerState
+{
+	std::atomic<bool> enabled{ false };
+	std::chrono::steady_clock::time_point epoch{ std::chrono::steady_clock::now() };
+
+	// 버퍼 등록/내보내기에만 쓰는 잠금. 기록 경로에서는 잡지 않는다.
+	std::mutex registryMutex{};
+	std::vector<std::shared_ptr<ThreadBuffer>> buffers{};
+	std::uint32_t nextThreadId{ 1 };
+};
+
+ProfilerState& GetState()
+{
+	static ProfilerState state{};
+	return state;
+}
+
+ThreadBuffer& GetThreadBuffer()
+{
+	// 스레드가 끝나도 내보낼 수 있도록 버퍼 소유권은 전역 목록이 가진다.
+	thread_local ThreadBuffer* buffer = nullptr;
+	if (buffer == nullptr) {
+		ProfilerState& state = GetState();
+		auto newBuffer = std::make_shared<ThreadBuffer>();
+		newBuffer->events.resize(Profiler::EVENTS_PER_THREAD);
+
+		std::lock_guard<std::mutex> lock(state.registryMutex);
+		newBuffer->threadId = state.nextThreadId++;
+		newBuffer->threadName = "thread " + std::to_string(newBuffer->threadId);
+		state.buffers.push_back(newBuffer);
+		buffer = newBuffer.get();
+	}
+	return *buffer;
+}
+
+void WriteEscaped(std::ostream& os, const std::string& text)
+{
+	for (char c : text) {
+		if (c == '"' || c == '\\') {
+			os << '\\';
+		}
+		os << c;
+	}
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+void Profiler::SetEnabled(bool enabled)
+{
+	GetState().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+bool Profiler::IsEnabled()
+{
+	return GetState().enabled.load(std::memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------------
+void Profiler::SetThreadName(const std::string& name)
+{
+	ThreadBuffer& buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> lock(GetState().registryMutex);
+	buffer.threadName = name;
+}
+
+//-----------------------------------------------------------------------------
+std::int64_t Profiler::Now()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - GetState().epoch).count();
+}
+
+//-----------------------------------------------------------------------------
+void Profiler::Record(const char* name, std::int64_t startNs, std::int64_t endNs)
+{
+	ThreadBuffer& buffer = GetThreadBuffer();
+	buffer.events[buffer.head] = ProfileEvent{ name, startNs, endNs };
+	buffer.head = (buffer.head + 1) % EVENTS_PER_THREAD;
+	++buffer.count;
+}
+
+//-----------------------------------------------------------------------------
+bool Profiler::WriteChromeTrace(const std::string& path)
+{
+	std::ofstream file(path);
+	if (!file) {
+		std::cerr << "[Profiler] failed to open " << path << std::endl;
+		return false;
+	}
+
+	ProfilerState& state = GetState();
+	std::lock_guard<std::mutex> lock(state.registryMutex);
+
+	// ts, dur 은 마이크로초 단위.
+	file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	bool first = true;
+	for (const std::shared_ptr<ThreadBuffer>& buffer : state.buffers) {
+		// 스레드 이름 메타데이터.
+		file << (first ? "" : ",\n")
+			<< "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+			<< ",\"args\":{\"name\":\"";
+		WriteEscaped(file, buffer->threadName);
+		file << "\"}}";
+		first = false;
+
+		std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(buffer->count, EVENTS_PER_THREAD));
+		std::size_t start = (buffer->count > EVENTS_PER_THREAD) ? buffer->head : 0;
+		for (std::size_t i = 0; i < count; ++i) {
+			const ProfileEvent& event = buffer->events[(start + i) % EVENTS_PER_THREAD];
+			file << ",\n{\"name\":\"";
+			WriteEscaped(file, event.name);
+			file << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+				<< ",\"ts\":" << (event.startNs / 1000) << '.' << (event.startNs % 1000) / 100
+				<< ",\"dur\":" << ((event.endNs - event.startNs) / 1000) << '.' << ((event.endNs - event.startNs) % 1000) / 100
+				<< "}";
+		}
+	}
+	file << "\n]}\n";
+
+	std::cout << "[Profiler] trace saved: " << path << std::endl;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void Profiler::Clear()
+{
+	ProfilerState& state = GetState();
+	std::lock_guard<std::mutex> lock(state.registryMutex);
+	for (const std::shared_ptr<ThreadBuffer>& buffer : state.buffers) {
+		buffer->head = 0;
+		buffer->count = 0;
+	}
+}
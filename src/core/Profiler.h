@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// CPU 구간 프로파일러.
+// 스레드마다 자기 이벤트 버퍼를 따로 가지고 있어서 기록할 때 잠금이 없다.
+// (버퍼를 처음 만들 때 한 번만 전역 목록에 등록한다)
+// 결과는 chrome://tracing 이나 Perfetto 에서 열 수 있는 JSON 으로 저장한다.
+//
+//	void Foo() {
+//		PROFILE_FUNCTION();
+//		{
+//			PROFILE_SCOPE("Foo::Inner");
+//			...
+//		}
+//	}
+class Profiler
+{
+public:
+	// 스레드 하나가 보관하는 최대 이벤트 수. 넘치면 오래된 이벤트부터 덮어쓴다.
+	static constexpr std::size_t EVENTS_PER_THREAD = 1 << 16;
+
+	static void SetEnabled(bool enabled);
+	static bool IsEnabled();
+
+	// 트레이스에 표시될 현재 스레드 이름.
+	static void SetThreadName(const std::string& name);
+
+	// 프로세스 시작 기준 나노초.
+	static std::int64_t Now();
+
+	// name 은 문자열 리터럴처럼 프로그램이 끝날 때까지 살아있는 문자열이어야 한다.
+	static void Record(const char* name, std::int64_t startNs, std::int64_t endNs);
+
+	// 모든 스레드의 이벤트를 Chrome trace JSON 으로 저장한다.
+	// 기록 중인 스레드가 없을 때(루프가 끝난 뒤) 호출해야 한다.
+	static bool WriteChromeTrace(const std::string& path);
+	static void Clear();
+};
+
+// 생성부터 소멸까지의 시간을 기록하는 RAII 객체.
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char* name)
+		: mName(name), mStart(Profiler::IsEnabled() ? Profiler::Now() : -1)
+	{
+	}
+
+	~ProfileScope() {
+		if (mStart >= 0) {
+			Profiler::Record(mName, mStart, Profiler::Now());
+		}
+	}
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+	const char* mName{};
+	std::int64_t mStart{};
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
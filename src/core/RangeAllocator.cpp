@@ -0,0 +1,104 @@
+#include "core/RangeAllocator.h"
+
+#include <algorithm>
+#include <iterator>
+
+//-----------------------------------------------------------------------------
+RangeAllocator::RangeAllocator(std::uint32_t capacity)
+{
+	Reset(capacity);
+}
+
+//-----------------------------------------------------------------------------
+void RangeAllocator::Reset(std::uint32_t capacity)
+{
+	mCapacity = capacity;
+	mUsedSize = 0;
+	mFreeBlocks.clear();
+	mAllocations.clear();
+	if (capacity > 0) {
+		mFreeBlocks[0] = capacity;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void RangeAllocator::Grow(std::uint32_t capacity)
+{
+	if (capacity <= mCapacity) {
+		return;
+	}
+	std::uint32_t offset = mCapacity;
+	std::uint32_t size = capacity - mCapacity;
+	mCapacity = capacity;
+
+	// 마지막 빈 구간이 끝까지 닿아 있으면 그 구간을 늘린다.
+	if (!mFreeBlocks.empty()) {
+		auto last = std::prev(mFreeBlocks.end());
+		if (last->first + last->second == offset) {
+			last->second += size;
+			return;
+		}
+	}
+	mFreeBlocks[offset] = size;
+}
+
+//-----------------------------------------------------------------------------
+std::uint32_t RangeAllocator::Allocate(std::uint32_t size)
+{
+	if (size == 0) {
+		return INVALID_OFFSET;
+	}
+	for (auto it = mFreeBlocks.begin(); it != mFreeBlocks.end(); ++it) {
+		if (it->second < size) {
+			continue;
+		}
+		std::uint32_t offset = it->first;
+		std::uint32_t remaining = it->second - size;
+		mFreeBlocks.erase(it);
+		if (remaining > 0) {
+			mFreeBlocks[offset + size] = remaining;
+		}
+		mAllocations[offset] = size;
+		mUsedSize += size;
+		return offset;
+	}
+	return INVALID_OFFSET;
+}
+
+//-----------------------------------------------------------------------------
+void RangeAllocator::Free(std::uint32_t offset)
+{
+	auto allocation = mAllocations.find(offset);
+	if (allocation == mAllocations.end()) {
+		return;
+	}
+	std::uint32_t size = allocation->second;
+	mAllocations.erase(allocation);
+	mUsedSize -= size;
+
+	// 뒤쪽 빈 구간과 합친다.
+	auto next = mFreeBlocks.lower_bound(offset);
+	if (next != mFreeBlocks.end() && offset + size == next->first) {
+		size += next->second;
+		next = mFreeBlocks.erase(next);
+	}
+	// 앞쪽 빈 구간과 합친다.
+	if (next != mFreeBlocks.begin()) {
+		auto previous = std::prev(next);
+		if (previous->first + previous->second == offset) {
+			previous->second += size;
+			return;
+		}
+	}
+	mFreeBlocks[offset] = size;
+}
+
+//-----------------------------------------------------------------------------
+std::uint32_t RangeAllocator::GetLargestFreeBlock() const
+{
+	std::uint32_t largest{};
+	for (const auto& block : mFreeBlocks) {
+		largest = std::max(largest, block.second);
+	}
+	return largest;
+}
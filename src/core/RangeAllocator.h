@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <map>
+
+// 버퍼 하나를 구간으로 나눠 주는 first-fit free-list 할당기. 단위(바이트, 버텍스 수 등)는 쓰는 쪽이 정한다.
+// 빈 구간은 시작 위치 순서로 들고 있다가, 해제할 때 앞뒤 빈 구간과 합친다.
+// GL 과 상관없는 장부만 관리한다. (실제 버퍼는 render/MeshArena 가 가진다)
+class RangeAllocator
+{
+public:
+	static constexpr std::uint32_t INVALID_OFFSET = 0xFFFFFFFFu;
+
+	RangeAllocator() = default;
+	explicit RangeAllocator(std::uint32_t capacity);
+
+	// 모든 할당을 버리고 capacity 크기의 빈 구간 하나로 시작한다.
+	void Reset(std::uint32_t capacity);
+	// 뒤쪽에 빈 구간을 붙여서 capacity 까지 늘린다. 기존 할당의 위치는 그대로다.
+	void Grow(std::uint32_t capacity);
+
+	// size 만큼 자리를 받는다. 들어갈 빈 구간이 없으면 INVALID_OFFSET.
+	std::uint32_t Allocate(std::uint32_t size);
+	// Allocate 가 돌려준 offset 을 돌려놓는다.
+	void Free(std::uint32_t offset);
+
+	std::uint32_t GetCapacity() const { return mCapacity; }
+	std::uint32_t GetUsedSize() const { return mUsedSize; }
+	std::uint32_t GetLargestFreeBlock() const;
+	std::size_t GetFreeBlockCount() const { return mFreeBlocks.size(); }
+	std::size_t GetAllocationCount() const { return mAllocations.size(); }
+
+private:
+	std::uint32_t mCapacity{};
+	std::uint32_t mUsedSize{};
+	// 시작 위치 -> 크기.
+	std::map<std::uint32_t, std::uint32_t> mFreeBlocks{};
+	std::map<std::uint32_t, std::uint32_t> mAllocations{};
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// 생산자 스레드 하나와 소비자 스레드 하나가 잠금 없이 데이터를 주고받는 삼중 버퍼.
+// 생산자는 back 버퍼에 쓰고 Publish() 로 middle 과 바꾼다.
+// 소비자는 Acquire() 로 새 데이터가 있으면 middle 과 front 를 바꿔서 가장 최신 데이터를 읽는다.
+// 서로 쓰는 버퍼가 겹치지 않으므로, 쓰는 동안 읽거나 읽는 동안 덮어쓰는 일이 없다.
+template <typename T>
+class TripleBuffer
+{
+public:
+	// 생산자: 다음에 내보낼 데이터를 쓸 버퍼.
+	T& GetWriteBuffer() { return mBuffers[mBack]; }
+
+	// 생산자: 다 쓴 버퍼를 소비자에게 넘긴다.
+	void Publish() {
+		std::uint8_t previous = mMiddle.exchange(static_cast<std::uint8_t>(mBack | DIRTY_BIT), std::memory_order_acq_rel);
+		mBack = previous & INDEX_MASK;
+	}
+
+	// 소비자: 새로 들어온 데이터가 있으면 front 로 가져오고 true 를 돌려준다.
+	bool Acquire() {
+		if ((mMiddle.load(std::memory_order_acquire) & DIRTY_BIT) == 0) {
+			return false;
+		}
+		std::uint8_t previous = mMiddle.exchange(mFront, std::memory_order_acq_rel);
+		mFront = previous & INDEX_MASK;
+		return true;
+	}
+
+	// 소비자: 가장 최근에 가져온 데이터.
+	const T& GetReadBuffer() const { return mBuffers[mFront]; }
+
+private:
+	static constexpr std::uint8_t INDEX_MASK = 0x3;
+	static constexpr std::uint8_t DIRTY_BIT = 0x4;
+
+	T mBuffers[3]{};
+	std::uint8_t mBack{ 0 };				// 생산자만 접근
+	std::uint8_t mFront{ 1 };				// 소비자만 접근
+	std::atomic<std::uint8_t> mMiddle{ 2 };	// 주고받는 칸 + 새 데이터 표시
+};
@@ -1,26 +1,75 @@
 #include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 
+#include "ExampleBase.h"
+#include "ExampleRegistry.h"
+#include "core/CommandLine.h"
 
-#include "glad/glad.h"
-#include "GLFW/glfw3.h"
+// 기본으로 실행할 예제.
+static const char* DEFAULT_EXAMPLE_ID = "04";
 
-//#include "ExampleBase.h"
-//#include "Example02.h"
-//#include "Example03.h"
-#include "Example04.h"
-int main() {
+//-----------------------------------------------------------------------------
+static void PrintUsage()
+{
+	std::cout << "usage: MyOpenGLStudy [--example=ID] [options]\n\n";
+	std::cout << "examples:\n";
+	for (const ExampleRegistry::Entry* entry : ExampleRegistry::Get().GetEntries()) {
+		std::cout << "  " << entry->id << "  " << entry->description << "\n";
+	}
+	std::cout << "\noptions:\n";
+	std::cout << "  --example=all     run every example in turn (e.g. with --golden)\n";
+	std::cout << "  --list            list examples and exit\n";
+	ExampleBase::PrintCommonOptions();
+	std::cout << "\nexample: MyOpenGLStudy --example=04 --frames=5000 --uncapped --report=out.json --uv=bigger --filter=linear\n";
+	std::cout << "         MyOpenGLStudy --example=all --headless --golden\n";
+}
 
-	//ExampleBase* example = new ExampleBase();
-	//example->Run();
+//-----------------------------------------------------------------------------
+int main(int argc, char** argv) {
+	CommandLine args(argc, argv);
 
-	//Example02 example02{};
-	//example02.Run();
+	if (args.Has("help") || args.Has("list")) {
+		PrintUsage();
+		return 0;
+	}
 
-	//Example03 example03{};
-	//example03.Run();
+	// 예제는 각 cpp 파일에서 REGISTER_EXAMPLE 로 등록되어 있다.
+	std::string exampleId = args.GetString("example", DEFAULT_EXAMPLE_ID);
+	std::vector<std::string> exampleIds{};
+	if (exampleId == "all") {
+		for (const ExampleRegistry::Entry* entry : ExampleRegistry::Get().GetEntries()) {
+			exampleIds.push_back(entry->id);
+		}
+	}
+	else {
+		exampleIds.push_back(exampleId);
+	}
 
-	Example04 example04{};
-	example04.RunWidthParam(UvType::Fit, GL_REPEAT, GL_LINEAR);
+	// 예제마다 읽는 옵션이 다르므로, 모든 예제를 설정한 뒤에 아무도 읽지 않은 옵션만 알린다.
+	std::vector<std::unique_ptr<ExampleBase>> examples{};
+	for (const std::string& id : exampleIds) {
+		std::unique_ptr<ExampleBase> example = ExampleRegistry::Get().Create(id);
+		if (example == nullptr) {
+			std::cerr << "Unknown example: " << id << "\n\n";
+			PrintUsage();
+			return 1;
+		}
+		example->Configure(args);
+		examples.push_back(std::move(example));
+	}
+	for (const std::string& option : args.GetUnusedOptions()) {
+		std::cerr << "Unknown option ignored: --" << option << std::endl;
+	}
 
-	return 0;
-}
\ No newline at end of file
+	// 하나라도 실패하면(골든 이미지 불일치 등) 0 이 아닌 값으로 끝낸다.
+	int exitCode = 0;
+	for (std::unique_ptr<ExampleBase>& example : examples) {
+		if (example->Run() != 0) {
+			exitCode = 1;
+		}
+		example.reset();
+	}
+	return exitCode;
+}
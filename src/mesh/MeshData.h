@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "common/Vertex.h"
+
+// 같은 재질을 쓰는 인덱스 구간.
+struct SubMesh
+{
+	std::string material{};
+	unsigned int indexOffset{};
+	unsigned int indexCount{};
+};
+
+// CPU 쪽 메시 데이터. 삼각형 리스트.
+struct MeshData
+{
+	std::string name{};
+	std::vector<ModelVertex> vertices{};
+	std::vector<unsigned int> indices{};
+	std::vector<SubMesh> subMeshes{};
+
+	std::size_t GetTriangleCount() const { return indices.size() / 3; }
+};
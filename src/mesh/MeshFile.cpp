@@ -0,0 +1,162 @@
+#include "mesh/MeshFile.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#include "mesh/MeshIndices.h"
+
+namespace {
+
+void WriteUint32(std::vector<std::uint8_t>& out, std::uint32_t value)
+{
+	std::uint8_t bytes[4];
+	std::memcpy(bytes, &value, sizeof(value));
+	out.insert(out.end(), bytes, bytes + sizeof(bytes));
+}
+
+void WriteBytes(std::vector<std::uint8_t>& out, const void* data, std::size_t size)
+{
+	const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+	out.insert(out.end(), bytes, bytes + size);
+}
+
+// 남은 크기를 확인하면서 앞에서부터 읽는다.
+struct Reader
+{
+	const std::uint8_t* cursor{};
+	const std::uint8_t* end{};
+
+	bool ReadBytes(void* data, std::size_t size)
+	{
+		if (static_cast<std::size_t>(end - cursor) < size) {
+			return false;
+		}
+		std::memcpy(data, cursor, size);
+		cursor += size;
+		return true;
+	}
+	bool ReadUint32(std::uint32_t& value)
+	{
+		return ReadBytes(&value, sizeof(value));
+	}
+};
+
+}
+
+//-----------------------------------------------------------------------------
+void MeshFile::Write(const MeshData& mesh, std::vector<std::uint8_t>& out, std::size_t* encodedIndexBytes)
+{
+	std::vector<std::uint8_t> encodedIndices{};
+	MeshIndices::Encode(mesh.indices.data(), mesh.indices.size(), encodedIndices);
+	if (encodedIndexBytes != nullptr) {
+		*encodedIndexBytes = encodedIndices.size();
+	}
+
+	out.clear();
+	WriteUint32(out, MAGIC);
+	WriteUint32(out, VERSION);
+	WriteUint32(out, static_cast<std::uint32_t>(sizeof(ModelVertex)));
+	WriteUint32(out, static_cast<std::uint32_t>(mesh.vertices.size()));
+	WriteUint32(out, static_cast<std::uint32_t>(mesh.indices.size()));
+	WriteUint32(out, static_cast<std::uint32_t>(encodedIndices.size()));
+	WriteUint32(out, static_cast<std::uint32_t>(mesh.subMeshes.size()));
+	for (const SubMesh& subMesh : mesh.subMeshes) {
+		WriteUint32(out, static_cast<std::uint32_t>(subMesh.material.size()));
+		WriteBytes(out, subMesh.material.data(), subMesh.material.size());
+		WriteUint32(out, subMesh.indexOffset);
+		WriteUint32(out, subMesh.indexCount);
+	}
+	WriteBytes(out, mesh.vertices.data(), mesh.vertices.size() * sizeof(ModelVertex));
+	WriteBytes(out, encodedIndices.data(), encodedIndices.size());
+}
+
+//-----------------------------------------------------------------------------
+bool MeshFile::Read(const std::uint8_t* data, std::size_t size, MeshData& mesh)
+{
+	Reader reader{ data, data + size };
+	std::uint32_t magic{};
+	std::uint32_t version{};
+	std::uint32_t vertexSize{};
+	std::uint32_t vertexCount{};
+	std::uint32_t indexCount{};
+	std::uint32_t encodedSize{};
+	std::uint32_t subMeshCount{};
+	if (!reader.ReadUint32(magic) || !reader.ReadUint32(version) || !reader.ReadUint32(vertexSize)
+		|| !reader.ReadUint32(vertexCount) || !reader.ReadUint32(indexCount)
+		|| !reader.ReadUint32(encodedSize) || !reader.ReadUint32(subMeshCount)) {
+		return false;
+	}
+	// 버텍스 구조가 바뀌었으면 다시 구워야 한다.
+	if (magic != MAGIC || version != VERSION || vertexSize != sizeof(ModelVertex)) {
+		return false;
+	}
+	// 크기를 잡기 전에 개수부터 검사한다. 서브메시 항목은 최소 12 바이트, 인덱스는 최소 1 바이트다.
+	if (subMeshCount > static_cast<std::size_t>(reader.end - reader.cursor) / 12 || indexCount > encodedSize) {
+		return false;
+	}
+
+	mesh.subMeshes.resize(subMeshCount);
+	for (SubMesh& subMesh : mesh.subMeshes) {
+		std::uint32_t nameLength{};
+		if (!reader.ReadUint32(nameLength) || static_cast<std::size_t>(reader.end - reader.cursor) < nameLength) {
+			return false;
+		}
+		subMesh.material.assign(reinterpret_cast<const char*>(reader.cursor), nameLength);
+		reader.cursor += nameLength;
+		if (!reader.ReadUint32(subMesh.indexOffset) || !reader.ReadUint32(subMesh.indexCount)) {
+			return false;
+		}
+		if (static_cast<std::uint64_t>(subMesh.indexOffset) + subMesh.indexCount > indexCount) {
+			return false;
+		}
+	}
+
+	if (static_cast<std::uint64_t>(reader.end - reader.cursor) < static_cast<std::uint64_t>(vertexCount) * sizeof(ModelVertex) + encodedSize) {
+		return false;
+	}
+	mesh.vertices.resize(vertexCount);
+	reader.ReadBytes(mesh.vertices.data(), static_cast<std::size_t>(vertexCount) * sizeof(ModelVertex));
+	if (!MeshIndices::Decode(reader.cursor, encodedSize, indexCount, mesh.indices)) {
+		return false;
+	}
+	for (unsigned int index : mesh.indices) {
+		if (index >= vertexCount) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool MeshFile::Save(const std::string& path, const MeshData& mesh, std::size_t* encodedIndexBytes)
+{
+	std::vector<std::uint8_t> bytes{};
+	Write(mesh, bytes, encodedIndexBytes);
+	std::ofstream file(path, std::ios::binary);
+	if (!file) {
+		std::cout << "Failed to write mesh file: " << path << std::endl;
+		return false;
+	}
+	file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	return static_cast<bool>(file);
+}
+
+//-----------------------------------------------------------------------------
+bool MeshFile::Load(const std::string& path, MeshData& mesh)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		std::cout << "Failed to open mesh file: " << path << std::endl;
+		return false;
+	}
+	std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	mesh.name = path;
+	if (!Read(bytes.data(), bytes.size(), mesh)) {
+		std::cout << "[MeshFile] invalid or outdated mesh file: " << path << std::endl;
+		return false;
+	}
+	return true;
+}
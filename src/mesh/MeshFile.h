@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mesh/MeshData.h"
+
+// 로드 시간을 줄이려고 미리 구워 둔 메시 파일. (.mesh)
+// 헤더, 서브메시 표, ModelVertex 배열을 그대로 적고 인덱스는 MeshIndices::Encode 로 압축해서 적는다.
+// 읽을 때는 버텍스를 한 번에 복사하고 인덱스만 푼다. (리틀 엔디언 기준)
+namespace MeshFile
+{
+	constexpr std::uint32_t MAGIC = 0x4853454D;	// "MESH"
+	constexpr std::uint32_t VERSION = 1;
+
+	// encodedIndexBytes 를 주면 압축한 인덱스 크기를 돌려준다.
+	bool Save(const std::string& path, const MeshData& mesh, std::size_t* encodedIndexBytes = nullptr);
+	bool Load(const std::string& path, MeshData& mesh);
+
+	// 파일 내용(메모리)으로 직접 읽고 쓴다.
+	void Write(const MeshData& mesh, std::vector<std::uint8_t>& out, std::size_t* encodedIndexBytes = nullptr);
+	bool Read(const std::uint8_t* data, std::size_t size, MeshData& mesh);
+}
@@ -0,0 +1,123 @@
+#include "mesh/MeshIndices.h"
+
+#include <cstring>
+#include <unordered_map>
+
+//-----------------------------------------------------------------------------
+void MeshIndices::Pack(const unsigned int* indices, std::size_t indexCount, std::uint32_t indexSize, std::vector<std::uint8_t>& out)
+{
+	out.resize(indexCount * indexSize);
+	if (indexSize == 4) {
+		std::memcpy(out.data(), indices, out.size());
+		return;
+	}
+	std::uint16_t* packed = reinterpret_cast<std::uint16_t*>(out.data());
+	for (std::size_t i = 0; i < indexCount; ++i) {
+		packed[i] = static_cast<std::uint16_t>(indices[i]);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void MeshIndices::Split(const MeshData& mesh, std::uint32_t maxVertexCount, std::vector<MeshData>& parts)
+{
+	parts.clear();
+	if (mesh.vertices.size() <= maxVertexCount || maxVertexCount < 3) {
+		parts.push_back(mesh);
+		return;
+	}
+
+	// 원본 버텍스 번호 -> 지금 조각 안의 번호.
+	std::unordered_map<unsigned int, unsigned int> remap{};
+	auto beginPart = [&]() {
+		MeshData part{};
+		part.name = mesh.name;
+		part.subMeshes.resize(mesh.subMeshes.size());
+		for (std::size_t i = 0; i < mesh.subMeshes.size(); ++i) {
+			part.subMeshes[i].material = mesh.subMeshes[i].material;
+		}
+		parts.push_back(std::move(part));
+		remap.clear();
+	};
+	beginPart();
+
+	for (std::size_t subMeshIndex = 0; subMeshIndex < mesh.subMeshes.size(); ++subMeshIndex) {
+		const SubMesh& subMesh = mesh.subMeshes[subMeshIndex];
+		parts.back().subMeshes[subMeshIndex].indexOffset = static_cast<unsigned int>(parts.back().indices.size());
+
+		for (unsigned int i = 0; i + 2 < subMesh.indexCount; i += 3) {
+			const unsigned int* triangle = &mesh.indices[subMesh.indexOffset + i];
+			std::uint32_t newVertexCount = 0;
+			for (int corner = 0; corner < 3; ++corner) {
+				if (remap.find(triangle[corner]) == remap.end()) {
+					++newVertexCount;
+				}
+			}
+			// 삼각형이 다 들어가지 않으면 새 조각을 시작한다.
+			if (parts.back().vertices.size() + newVertexCount > maxVertexCount) {
+				beginPart();
+				parts.back().subMeshes[subMeshIndex].indexOffset = 0;
+			}
+
+			MeshData& part = parts.back();
+			for (int corner = 0; corner < 3; ++corner) {
+				auto found = remap.find(triangle[corner]);
+				if (found == remap.end()) {
+					found = remap.emplace(triangle[corner], static_cast<unsigned int>(part.vertices.size())).first;
+					part.vertices.push_back(mesh.vertices[triangle[corner]]);
+				}
+				part.indices.push_back(found->second);
+			}
+			part.subMeshes[subMeshIndex].indexCount += 3;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void MeshIndices::Encode(const unsigned int* indices, std::size_t indexCount, std::vector<std::uint8_t>& out)
+{
+	out.clear();
+	out.reserve(indexCount + indexCount / 4);
+	unsigned int previous = 0;
+	for (std::size_t i = 0; i < indexCount; ++i) {
+		std::int32_t delta = static_cast<std::int32_t>(indices[i] - previous);
+		std::uint32_t value = (static_cast<std::uint32_t>(delta) << 1) ^ static_cast<std::uint32_t>(delta >> 31);
+		while (value >= 0x80) {
+			out.push_back(static_cast<std::uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		out.push_back(static_cast<std::uint8_t>(value));
+		previous = indices[i];
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool MeshIndices::Decode(const std::uint8_t* data, std::size_t size, std::size_t indexCount, std::vector<unsigned int>& out)
+{
+	// 인덱스 하나는 최소 1 바이트라서 이보다 많으면 깨진 데이터다. 메모리를 잡기 전에 거른다.
+	if (indexCount > size) {
+		return false;
+	}
+	out.resize(indexCount);
+	const std::uint8_t* cursor = data;
+	const std::uint8_t* end = data + size;
+	unsigned int previous = 0;
+	for (std::size_t i = 0; i < indexCount; ++i) {
+		std::uint32_t value = 0;
+		int shift = 0;
+		while (true) {
+			if (cursor >= end || shift > 28) {
+				return false;
+			}
+			std::uint8_t byte = *cursor++;
+			value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0) {
+				break;
+			}
+			shift += 7;
+		}
+		std::uint32_t delta = (value >> 1) ^ (0u - (value & 1));
+		previous += delta;
+		out[i] = previous;
+	}
+	return cursor == end;
+}
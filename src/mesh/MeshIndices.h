@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "mesh/MeshData.h"
+
+// 인덱스 폭 선택, 16비트 한도를 넘는 메시 나누기, 디스크용 인덱스 압축.
+// (GL 헤더 없이 쓰려고 GL enum 값을 직접 적는다)
+namespace MeshIndices
+{
+	// 16비트 인덱스로 가리킬 수 있는 버텍스 수.
+	constexpr std::uint32_t MAX_16BIT_VERTEX_COUNT = 65536;
+
+	// 버텍스 수에 맞는 인덱스 크기. (2 또는 4바이트)
+	inline std::uint32_t ChooseIndexSize(std::size_t vertexCount)
+	{
+		return (vertexCount <= MAX_16BIT_VERTEX_COUNT) ? 2u : 4u;
+	}
+	// 인덱스 크기의 GL 타입. (GL_UNSIGNED_SHORT / GL_UNSIGNED_INT)
+	inline unsigned int GetIndexType(std::uint32_t indexSize)
+	{
+		return (indexSize == 2) ? 0x1403u : 0x1405u;
+	}
+
+	// indexSize 바이트 인덱스로 바꿔서 out 에 채운다. 값이 들어가는지는 부르는 쪽이 확인한다.
+	void Pack(const unsigned int* indices, std::size_t indexCount, std::uint32_t indexSize, std::vector<std::uint8_t>& out);
+
+	// 버텍스가 maxVertexCount 보다 많으면 삼각형 순서대로 잘라서 여러 메시로 나눈다.
+	// 조각마다 서브메시 목록은 원본과 같은 개수다. (그 조각에 없는 재질은 indexCount 가 0)
+	// 나눌 필요가 없으면 원본 하나를 그대로 담는다.
+	void Split(const MeshData& mesh, std::uint32_t maxVertexCount, std::vector<MeshData>& parts);
+
+	// 인덱스 압축. 앞 인덱스와의 차이를 zigzag 로 부호 없는 수로 바꾼 뒤 7비트씩 varint 로 적는다.
+	// 캐시 순서로 정리된 메시는 차이가 작아서 대부분 1바이트가 된다.
+	void Encode(const unsigned int* indices, std::size_t indexCount, std::vector<std::uint8_t>& out);
+	// indexCount 개를 풀어서 out 에 채운다. 데이터가 모자라거나 깨졌으면 false.
+	bool Decode(const std::uint8_t* data, std::size_t size, std::size_t indexCount, std::vector<unsigned int>& out);
+}
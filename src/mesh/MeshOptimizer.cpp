@@ -0,0 +1,277 @@
+#include "mesh/MeshOptimizer.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+// 버텍스마다 그 버텍스를 쓰는 삼각형 목록. (CSR 형태)
+struct TriangleAdjacency
+{
+	std::vector<std::uint32_t> offsets{};
+	std::vector<std::uint32_t> triangles{};
+
+	void Build(const unsigned int* indices, std::size_t indexCount, std::size_t vertexCount)
+	{
+		offsets.assign(vertexCount + 1, 0);
+		for (std::size_t i = 0; i < indexCount; ++i) {
+			++offsets[indices[i] + 1];
+		}
+		for (std::size_t v = 0; v < vertexCount; ++v) {
+			offsets[v + 1] += offsets[v];
+		}
+		triangles.resize(indexCount);
+		std::vector<std::uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+		for (std::size_t i = 0; i < indexCount; ++i) {
+			triangles[cursor[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+		}
+	}
+};
+
+// Tipsify 에서 막혔을 때 다음 부채 중심을 찾는다. 최근에 나온 버텍스부터, 없으면 번호 순서대로.
+int SkipDeadEnd(const std::vector<std::uint32_t>& liveCounts, std::vector<unsigned int>& deadEnds,
+	std::size_t& cursor, std::size_t vertexCount)
+{
+	while (!deadEnds.empty()) {
+		unsigned int vertex = deadEnds.back();
+		deadEnds.pop_back();
+		if (liveCounts[vertex] > 0) {
+			return static_cast<int>(vertex);
+		}
+	}
+	while (cursor < vertexCount) {
+		if (liveCounts[cursor] > 0) {
+			return static_cast<int>(cursor);
+		}
+		++cursor;
+	}
+	return -1;
+}
+
+}
+
+//-----------------------------------------------------------------------------
+MeshOptimizer::VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const unsigned int* indices, std::size_t indexCount,
+	std::size_t vertexCount, std::uint32_t cacheSize)
+{
+	VertexCacheStats stats{};
+	if (indexCount < 3 || vertexCount == 0) {
+		return stats;
+	}
+
+	// 버텍스가 캐시에 들어간 시각. 지금 시각과 cacheSize 이상 차이 나면 밀려난 것이다.
+	std::vector<std::uint32_t> timestamps(vertexCount, 0);
+	std::vector<bool> used(vertexCount, false);
+	std::uint32_t time = cacheSize + 1;
+	std::size_t misses = 0;
+	std::size_t usedCount = 0;
+	for (std::size_t i = 0; i < indexCount; ++i) {
+		unsigned int vertex = indices[i];
+		if (time - timestamps[vertex] > cacheSize) {
+			timestamps[vertex] = time++;
+			++misses;
+		}
+		if (!used[vertex]) {
+			used[vertex] = true;
+			++usedCount;
+		}
+	}
+	stats.acmr = static_cast<float>(misses) / static_cast<float>(indexCount / 3);
+	stats.atvr = static_cast<float>(misses) / static_cast<float>(usedCount);
+	return stats;
+}
+
+//-----------------------------------------------------------------------------
+void MeshOptimizer::OptimizeVertexCache(unsigned int* indices, std::size_t indexCount, std::size_t vertexCount, std::uint32_t cacheSize)
+{
+	std::size_t triangleCount = indexCount / 3;
+	if (triangleCount == 0) {
+		return;
+	}
+
+	TriangleAdjacency adjacency{};
+	adjacency.Build(indices, triangleCount * 3, vertexCount);
+
+	std::vector<std::uint32_t> liveCounts(vertexCount, 0);
+	for (std::size_t v = 0; v < vertexCount; ++v) {
+		liveCounts[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+	}
+	std::vector<std::uint32_t> timestamps(vertexCount, 0);
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<unsigned int> deadEnds{};
+	std::vector<unsigned int> candidates{};
+	std::vector<unsigned int> result{};
+	result.reserve(triangleCount * 3);
+
+	std::uint32_t time = cacheSize + 1;
+	std::size_t cursor = 0;
+	int fanning = SkipDeadEnd(liveCounts, deadEnds, cursor, vertexCount);
+	while (fanning >= 0) {
+		// 부채 중심을 쓰는 남은 삼각형을 모두 내보낸다.
+		candidates.clear();
+		for (std::uint32_t k = adjacency.offsets[fanning]; k < adjacency.offsets[fanning + 1]; ++k) {
+			std::uint32_t triangle = adjacency.triangles[k];
+			if (emitted[triangle]) {
+				continue;
+			}
+			emitted[triangle] = true;
+			for (int corner = 0; corner < 3; ++corner) {
+				unsigned int vertex = indices[triangle * 3 + corner];
+				result.push_back(vertex);
+				deadEnds.push_back(vertex);
+				candidates.push_back(vertex);
+				--liveCounts[vertex];
+				if (time - timestamps[vertex] > cacheSize) {
+					timestamps[vertex] = time++;
+				}
+			}
+		}
+
+		// 다음 중심: 남은 삼각형을 다 내보내도 캐시에 남아 있을 버텍스 중 가장 오래된 것.
+		int next = -1;
+		int bestPriority = -1;
+		for (unsigned int vertex : candidates) {
+			if (liveCounts[vertex] == 0) {
+				continue;
+			}
+			int priority = 0;
+			std::uint32_t age = time - timestamps[vertex];
+			if (age + 2 * liveCounts[vertex] <= cacheSize) {
+				priority = static_cast<int>(age);
+			}
+			if (priority > bestPriority) {
+				bestPriority = priority;
+				next = static_cast<int>(vertex);
+			}
+		}
+		if (next < 0) {
+			next = SkipDeadEnd(liveCounts, deadEnds, cursor, vertexCount);
+		}
+		fanning = next;
+	}
+	std::copy(result.begin(), result.end(), indices);
+}
+
+//-----------------------------------------------------------------------------
+void MeshOptimizer::OptimizeOverdraw(unsigned int* indices, std::size_t indexCount, const ModelVertex* vertices, std::size_t vertexCount,
+	float threshold, std::uint32_t cacheSize)
+{
+	std::size_t triangleCount = indexCount / 3;
+	if (triangleCount < 2) {
+		return;
+	}
+	float meshAcmr = AnalyzeVertexCache(indices, triangleCount * 3, vertexCount, cacheSize).acmr;
+
+	// 묶음 경계: 묶음 안의 캐시 미스 비율이 전체 ACMR * threshold 이하로 내려오면 끊는다.
+	// 끊은 뒤에는 캐시가 비었다고 보고 다시 센다. (묶음 순서를 바꿔도 캐시 손해가 threshold 안에 든다)
+	std::vector<std::size_t> clusterStarts{ 0 };
+	std::vector<std::uint32_t> timestamps(vertexCount, 0);
+	std::uint32_t time = cacheSize + 1;
+	std::size_t clusterMisses = 0;
+	for (std::size_t triangle = 0; triangle < triangleCount; ++triangle) {
+		for (int corner = 0; corner < 3; ++corner) {
+			unsigned int vertex = indices[triangle * 3 + corner];
+			if (time - timestamps[vertex] > cacheSize) {
+				timestamps[vertex] = time++;
+				++clusterMisses;
+			}
+		}
+		std::size_t clusterTriangles = triangle + 1 - clusterStarts.back();
+		if (triangle + 1 < triangleCount
+			&& static_cast<float>(clusterMisses) / static_cast<float>(clusterTriangles) <= meshAcmr * threshold) {
+			clusterStarts.push_back(triangle + 1);
+			clusterMisses = 0;
+			time += cacheSize + 1;
+		}
+	}
+	clusterStarts.push_back(triangleCount);
+	std::size_t clusterCount = clusterStarts.size() - 1;
+	if (clusterCount < 2) {
+		return;
+	}
+
+	// 묶음마다 (중심 - 메시 중심) · (면적 가중 법선). 클수록 바깥을 보므로 먼저 그려서 안쪽을 가린다.
+	glm::vec3 meshCentroid(0.0f);
+	float meshArea = 0.0f;
+	std::vector<glm::vec3> clusterCentroids(clusterCount, glm::vec3(0.0f));
+	std::vector<glm::vec3> clusterNormals(clusterCount, glm::vec3(0.0f));
+	std::vector<float> clusterAreas(clusterCount, 0.0f);
+	for (std::size_t cluster = 0; cluster < clusterCount; ++cluster) {
+		for (std::size_t triangle = clusterStarts[cluster]; triangle < clusterStarts[cluster + 1]; ++triangle) {
+			const glm::vec3& a = vertices[indices[triangle * 3 + 0]].mPosition;
+			const glm::vec3& b = vertices[indices[triangle * 3 + 1]].mPosition;
+			const glm::vec3& c = vertices[indices[triangle * 3 + 2]].mPosition;
+			glm::vec3 normal = glm::cross(b - a, c - a);
+			float area = glm::length(normal);
+			glm::vec3 center = (a + b + c) / 3.0f;
+			clusterCentroids[cluster] += center * area;
+			clusterNormals[cluster] += normal;
+			clusterAreas[cluster] += area;
+			meshCentroid += center * area;
+			meshArea += area;
+		}
+	}
+	if (meshArea > 0.0f) {
+		meshCentroid /= meshArea;
+	}
+
+	std::vector<float> sortKeys(clusterCount, 0.0f);
+	for (std::size_t cluster = 0; cluster < clusterCount; ++cluster) {
+		glm::vec3 centroid = (clusterAreas[cluster] > 0.0f) ? clusterCentroids[cluster] / clusterAreas[cluster] : meshCentroid;
+		float normalLength = glm::length(clusterNormals[cluster]);
+		glm::vec3 normal = (normalLength > 0.0f) ? clusterNormals[cluster] / normalLength : glm::vec3(0.0f);
+		sortKeys[cluster] = glm::dot(centroid - meshCentroid, normal);
+	}
+
+	std::vector<std::size_t> order(clusterCount);
+	for (std::size_t cluster = 0; cluster < clusterCount; ++cluster) {
+		order[cluster] = cluster;
+	}
+	std::stable_sort(order.begin(), order.end(), [&sortKeys](std::size_t left, std::size_t right) {
+		return sortKeys[left] > sortKeys[right];
+	});
+
+	std::vector<unsigned int> result{};
+	result.reserve(triangleCount * 3);
+	for (std::size_t cluster : order) {
+		result.insert(result.end(), indices + clusterStarts[cluster] * 3, indices + clusterStarts[cluster + 1] * 3);
+	}
+	std::copy(result.begin(), result.end(), indices);
+}
+
+//-----------------------------------------------------------------------------
+void MeshOptimizer::OptimizeVertexFetch(MeshData& mesh)
+{
+	const unsigned int UNUSED = 0xFFFFFFFFu;
+	std::vector<unsigned int> remap(mesh.vertices.size(), UNUSED);
+	std::vector<ModelVertex> vertices{};
+	vertices.reserve(mesh.vertices.size());
+	for (unsigned int& index : mesh.indices) {
+		if (remap[index] == UNUSED) {
+			remap[index] = static_cast<unsigned int>(vertices.size());
+			vertices.push_back(mesh.vertices[index]);
+		}
+		index = remap[index];
+	}
+	mesh.vertices.swap(vertices);
+}
+
+//-----------------------------------------------------------------------------
+MeshOptimizer::Report MeshOptimizer::Optimize(MeshData& mesh)
+{
+	Report report{};
+	report.before = AnalyzeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size());
+
+	for (const SubMesh& subMesh : mesh.subMeshes) {
+		if (subMesh.indexCount < 3) {
+			continue;
+		}
+		unsigned int* indices = mesh.indices.data() + subMesh.indexOffset;
+		OptimizeVertexCache(indices, subMesh.indexCount, mesh.vertices.size());
+		OptimizeOverdraw(indices, subMesh.indexCount, mesh.vertices.data(), mesh.vertices.size());
+	}
+	OptimizeVertexFetch(mesh);
+
+	report.after = AnalyzeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size());
+	return report;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "mesh/MeshData.h"
+
+// 로드(쿡) 시점에 삼각형과 버텍스 순서를 GPU 에 맞게 바꾸는 단계.
+// 1. 버텍스 캐시: Tipsify(Sander et al. 2007)로 최근 변환한 버텍스를 다시 쓰도록 삼각형 순서를 바꾼다.
+// 2. 오버드로: 캐시 효율이 크게 나빠지지 않는 지점에서 삼각형 묶음을 나누고, 바깥을 보는 묶음이 먼저 그려지게 정렬한다.
+// 3. 버텍스 페치: 인덱스에 처음 나오는 순서대로 버텍스를 다시 배치한다.
+// 서브메시 구간은 그대로 두고 구간 안에서만 삼각형을 옮긴다.
+namespace MeshOptimizer
+{
+	// 시뮬레이션과 Tipsify 가 가정하는 FIFO 캐시 크기.
+	constexpr std::uint32_t VERTEX_CACHE_SIZE = 16;
+	// 오버드로 정렬로 허용하는 ACMR 증가 비율.
+	constexpr float OVERDRAW_THRESHOLD = 1.05f;
+
+	// ACMR: 삼각형당 버텍스 셰이더 실행 수. (최소 0.5 근처, 최악 3)
+	// ATVR: 버텍스당 실행 수. (최소 1)
+	struct VertexCacheStats
+	{
+		float acmr{};
+		float atvr{};
+	};
+
+	struct Report
+	{
+		VertexCacheStats before{};
+		VertexCacheStats after{};
+	};
+
+	// FIFO 캐시로 인덱스 순서를 시뮬레이션한다.
+	VertexCacheStats AnalyzeVertexCache(const unsigned int* indices, std::size_t indexCount, std::size_t vertexCount,
+		std::uint32_t cacheSize = VERTEX_CACHE_SIZE);
+
+	// 삼각형 순서를 바꾼다. (제자리)
+	void OptimizeVertexCache(unsigned int* indices, std::size_t indexCount, std::size_t vertexCount,
+		std::uint32_t cacheSize = VERTEX_CACHE_SIZE);
+	// 캐시 순서가 된 인덱스를 묶음 단위로 앞뒤 정렬한다. (제자리)
+	void OptimizeOverdraw(unsigned int* indices, std::size_t indexCount, const ModelVertex* vertices, std::size_t vertexCount,
+		float threshold = OVERDRAW_THRESHOLD, std::uint32_t cacheSize = VERTEX_CACHE_SIZE);
+	// 버텍스를 처음 쓰이는 순서로 옮기고 인덱스를 고친다. 안 쓰이는 버텍스는 지운다.
+	void OptimizeVertexFetch(MeshData& mesh);
+
+	// 세 단계를 서브메시마다 하고 앞뒤 통계를 돌려준다.
+	Report Optimize(MeshData& mesh);
+}
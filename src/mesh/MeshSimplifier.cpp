@@ -0,0 +1,795 @@
+#include "mesh/MeshSimplifier.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace {
+
+// 면적으로 가중한 평면 거리 제곱의 합. 대칭 4x4 행렬의 위쪽 삼각형 10개와 가중치 합.
+// Evaluate 는 가중 평균이라서 제곱근을 모델 공간 거리처럼 쓸 수 있다.
+struct Quadric
+{
+	double a2{}, ab{}, ac{}, ad{};
+	double b2{}, bc{}, bd{};
+	double c2{}, cd{};
+	double d2{};
+	double weight{};
+
+	void AddPlane(const glm::dvec3& normal, double distance, double planeWeight)
+	{
+		a2 += planeWeight * normal.x * normal.x; ab += planeWeight * normal.x * normal.y;
+		ac += planeWeight * normal.x * normal.z; ad += planeWeight * normal.x * distance;
+		b2 += planeWeight * normal.y * normal.y; bc += planeWeight * normal.y * normal.z; bd += planeWeight * normal.y * distance;
+		c2 += planeWeight * normal.z * normal.z; cd += planeWeight * normal.z * distance;
+		d2 += planeWeight * distance * distance;
+		weight += planeWeight;
+	}
+	void Add(const Quadric& other)
+	{
+		a2 += other.a2; ab += other.ab; ac += other.ac; ad += other.ad;
+		b2 += other.b2; bc += other.bc; bd += other.bd;
+		c2 += other.c2; cd += other.cd;
+		d2 += other.d2;
+		weight += other.weight;
+	}
+	double Evaluate(const glm::vec3& point) const
+	{
+		if (weight <= 0.0) {
+			return 0.0;
+		}
+		double x = point.x, y = point.y, z = point.z;
+		double result = a2 * x * x + 2.0 * ab * x * y + 2.0 * ac * x * z + 2.0 * ad * x
+			+ b2 * y * y + 2.0 * bc * y * z + 2.0 * bd * y
+			+ c2 * z * z + 2.0 * cd * z
+			+ d2;
+		return std::max(result / weight, 0.0);
+	}
+};
+
+// 합친 버텍스 키. (위치, uv, 색상의 비트가 같으면 같은 버텍스)
+struct WeldKey
+{
+	std::array<std::uint32_t, 8> bits{};
+
+	bool operator==(const WeldKey& other) const { return bits == other.bits; }
+};
+
+struct WeldKeyHash
+{
+	std::size_t operator()(const WeldKey& key) const {
+		std::size_t hash = 0;
+		for (std::uint32_t value : key.bits) {
+			hash = hash * 31u + value;
+		}
+		return hash;
+	}
+};
+
+WeldKey MakeWeldKey(const ModelVertex& vertex)
+{
+	const float values[8] = {
+		vertex.mPosition.x, vertex.mPosition.y, vertex.mPosition.z,
+		vertex.mUv.x, vertex.mUv.y,
+		vertex.mColor.r, vertex.mColor.g, vertex.mColor.b };
+	WeldKey key{};
+	std::memcpy(key.bits.data(), values, sizeof(values));
+	return key;
+}
+
+// 노멀이 이만큼 이상 벌어진 원본 버텍스가 합쳐졌으면 각진 버텍스로 본다. (cos 1도)
+const float SMOOTH_NORMAL_COS = 0.9998f;
+
+// 접기 전후 면 방향이 이 cos 보다 많이 돌아가면 접지 않는다.
+const float MAX_FLIP_COS = 0.2f;
+
+// 측정한 오차가 한도를 넘으면 덜 줄여서 다시 접어 보는 횟수.
+const int MAX_REDUCE_ATTEMPTS = 4;
+
+// 점에서 삼각형 (a, b, c) 까지 가장 가까운 거리의 제곱. (Ericson, Real-Time Collision Detection 5.1.5)
+float PointTriangleDistance2(const glm::vec3& p, const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+{
+	glm::vec3 ab = b - a;
+	glm::vec3 ac = c - a;
+	glm::vec3 ap = p - a;
+	float d1 = glm::dot(ab, ap);
+	float d2 = glm::dot(ac, ap);
+	if (d1 <= 0.0f && d2 <= 0.0f) {
+		return glm::dot(ap, ap);
+	}
+	glm::vec3 bp = p - b;
+	float d3 = glm::dot(ab, bp);
+	float d4 = glm::dot(ac, bp);
+	if (d3 >= 0.0f && d4 <= d3) {
+		return glm::dot(bp, bp);
+	}
+	float vc = d1 * d4 - d3 * d2;
+	if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+		glm::vec3 q = a + ab * (d1 / (d1 - d3));
+		return glm::dot(p - q, p - q);
+	}
+	glm::vec3 cp = p - c;
+	float d5 = glm::dot(ab, cp);
+	float d6 = glm::dot(ac, cp);
+	if (d6 >= 0.0f && d5 <= d6) {
+		return glm::dot(cp, cp);
+	}
+	float vb = d5 * d2 - d1 * d6;
+	if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+		glm::vec3 q = a + ac * (d2 / (d2 - d6));
+		return glm::dot(p - q, p - q);
+	}
+	float va = d3 * d6 - d5 * d4;
+	if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+		glm::vec3 q = b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+		return glm::dot(p - q, p - q);
+	}
+	float denominator = 1.0f / (va + vb + vc);
+	glm::vec3 q = a + ab * (vb * denominator) + ac * (vc * denominator);
+	return glm::dot(p - q, p - q);
+}
+
+// 버텍스 종류. 열린 모서리(같은 서브메시의 반대쪽 삼각형이 없는 모서리)의 개수로 정한다.
+enum class VertexKind
+{
+	Interior,	// 열린 모서리가 없다. 아무 이웃으로나 접을 수 있다.
+	Border,		// 열린 모서리가 둘이다. 테두리를 따라서만 접는다.
+	Locked		// 테두리가 갈라지거나 만나는 곳. 움직이지 않는다.
+};
+
+// 접기 하나. 같은 위치의 버텍스(UV 이음매 양쪽)는 같이 접는다.
+struct CollapsePair
+{
+	std::uint32_t from{};
+	std::uint32_t to{};
+};
+
+// 접는 중인 메시 상태.
+class Simplifier
+{
+public:
+	explicit Simplifier(const MeshData& mesh);
+
+	// 살아 있는 삼각형이 target 개 이하가 될 때까지 접는다. 오차가 maxError 를 넘는 모서리는 접지 않는다.
+	void Run(std::size_t targetTriangleCount, float maxError);
+	std::size_t GetTriangleCount() const { return mAliveTriangleCount; }
+	float GetRadius() const { return mRadius; }
+	// 접혀서 없어진 원본 버텍스에서 지금 표면까지의 최대 거리. (남은 버텍스는 원래 자리라서 0)
+	float MeasureDeviation() const;
+	// 지금 상태를 MeshData 로 만든다.
+	void Extract(MeshData& out) const;
+
+private:
+	// 살아 있는 삼각형으로 버텍스 종류와 테두리 이웃을 다시 구한다.
+	void Classify();
+	// from -> to 를 접을 때 같이 접어야 하는 쌍들. 접을 수 없는 모양이면 false.
+	bool BuildCollapse(std::uint32_t from, std::uint32_t to, std::vector<CollapsePair>& pairs) const;
+	double GetCost(const std::vector<CollapsePair>& pairs) const;
+	bool CanCollapse(std::uint32_t from, std::uint32_t to) const;
+	void Collapse(std::uint32_t from, std::uint32_t to);
+
+private:
+	// 복사해서 시험 삼아 접어 볼 수 있게 참조 대신 포인터로 든다.
+	const MeshData* mSource{};
+	// 합친 버텍스마다: 대표 원본 버텍스, 위치, 위치 그룹, quadric, 각진 버텍스인지.
+	std::vector<std::uint32_t> mRepresentative{};
+	std::vector<glm::vec3> mPositions{};
+	std::vector<std::uint32_t> mGroups{};
+	std::vector<Quadric> mQuadrics{};
+	std::vector<bool> mHard{};
+	// 위치 그룹(위치가 같은 버텍스들)의 구성원.
+	std::vector<std::vector<std::uint32_t>> mGroupMembers{};
+	// 삼각형마다: 세 꼭지점(합친 번호), 서브메시, 살아 있는지.
+	std::vector<std::array<std::uint32_t, 3>> mTriangles{};
+	std::vector<std::uint32_t> mTriangleSubMesh{};
+	std::vector<bool> mTriangleAlive{};
+	// 합친 버텍스를 쓰는 삼각형 목록. (죽은 삼각형도 남아 있을 수 있다)
+	std::vector<std::vector<std::uint32_t>> mVertexTriangles{};
+	// Classify 결과.
+	std::vector<VertexKind> mKinds{};
+	std::vector<std::vector<std::uint32_t>> mBorderNeighbors{};
+
+	std::size_t mAliveTriangleCount{};
+	float mRadius{};
+};
+
+//-----------------------------------------------------------------------------
+Simplifier::Simplifier(const MeshData& mesh)
+	: mSource(&mesh)
+{
+	// 버텍스 합치기. 위치만 같은 버텍스끼리는 위치 그룹으로 묶는다.
+	std::unordered_map<WeldKey, std::uint32_t, WeldKeyHash> lookup{};
+	std::unordered_map<WeldKey, std::uint32_t, WeldKeyHash> groupLookup{};
+	std::vector<std::uint32_t> weld(mesh.vertices.size());
+	for (std::size_t i = 0; i < mesh.vertices.size(); ++i) {
+		auto found = lookup.emplace(MakeWeldKey(mesh.vertices[i]), static_cast<std::uint32_t>(mRepresentative.size()));
+		if (found.second) {
+			ModelVertex positionOnly{};
+			positionOnly.mPosition = mesh.vertices[i].mPosition;
+			auto group = groupLookup.emplace(MakeWeldKey(positionOnly), static_cast<std::uint32_t>(mGroupMembers.size()));
+			if (group.second) {
+				mGroupMembers.push_back({});
+			}
+			mGroupMembers[group.first->second].push_back(found.first->second);
+			mGroups.push_back(group.first->second);
+			mRepresentative.push_back(static_cast<std::uint32_t>(i));
+			mPositions.push_back(mesh.vertices[i].mPosition);
+			mHard.push_back(false);
+		}
+		else {
+			const glm::vec3& first = mesh.vertices[mRepresentative[found.first->second]].mNormal;
+			if (glm::dot(first, mesh.vertices[i].mNormal) < SMOOTH_NORMAL_COS * glm::length(first) * glm::length(mesh.vertices[i].mNormal)) {
+				mHard[found.first->second] = true;
+			}
+		}
+		weld[i] = found.first->second;
+	}
+	std::size_t vertexCount = mRepresentative.size();
+	if (vertexCount > 0) {
+		glm::vec3 minimum = mPositions[0];
+		glm::vec3 maximum = mPositions[0];
+		for (const glm::vec3& position : mPositions) {
+			minimum = glm::min(minimum, position);
+			maximum = glm::max(maximum, position);
+		}
+		mRadius = glm::length(maximum - minimum) * 0.5f;
+	}
+	mQuadrics.assign(vertexCount, Quadric{});
+	mVertexTriangles.assign(vertexCount, {});
+
+	for (std::size_t subMeshIndex = 0; subMeshIndex < mesh.subMeshes.size(); ++subMeshIndex) {
+		const SubMesh& subMesh = mesh.subMeshes[subMeshIndex];
+		for (unsigned int i = 0; i + 2 < subMesh.indexCount; i += 3) {
+			std::array<std::uint32_t, 3> triangle{};
+			for (int corner = 0; corner < 3; ++corner) {
+				triangle[corner] = weld[mesh.indices[subMesh.indexOffset + i + corner]];
+			}
+			if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2]) {
+				continue;
+			}
+			std::uint32_t triangleIndex = static_cast<std::uint32_t>(mTriangles.size());
+			mTriangles.push_back(triangle);
+			mTriangleSubMesh.push_back(static_cast<std::uint32_t>(subMeshIndex));
+			mTriangleAlive.push_back(true);
+			for (std::uint32_t vertex : triangle) {
+				mVertexTriangles[vertex].push_back(triangleIndex);
+			}
+
+			// 면 평면의 quadric 을 세 꼭지점에 더한다.
+			glm::dvec3 p0 = mPositions[triangle[0]];
+			glm::dvec3 normal = glm::cross(glm::dvec3(mPositions[triangle[1]]) - p0, glm::dvec3(mPositions[triangle[2]]) - p0);
+			double length = glm::length(normal);
+			if (length > 0.0) {
+				normal /= length;
+				Quadric plane{};
+				plane.AddPlane(normal, -glm::dot(normal, p0), length * 0.5);
+				for (std::uint32_t vertex : triangle) {
+					mQuadrics[vertex].Add(plane);
+				}
+			}
+		}
+	}
+	mAliveTriangleCount = mTriangles.size();
+
+	// 테두리 모서리에는 모서리를 지나고 면에 수직인 평면을 더해서 테두리 모양이 유지되게 한다.
+	Classify();
+	for (std::size_t t = 0; t < mTriangles.size(); ++t) {
+		const std::array<std::uint32_t, 3>& triangle = mTriangles[t];
+		glm::dvec3 p0 = mPositions[triangle[0]];
+		glm::dvec3 faceNormal = glm::cross(glm::dvec3(mPositions[triangle[1]]) - p0, glm::dvec3(mPositions[triangle[2]]) - p0);
+		if (glm::length(faceNormal) <= 0.0) {
+			continue;
+		}
+		for (int corner = 0; corner < 3; ++corner) {
+			std::uint32_t a = triangle[corner];
+			std::uint32_t b = triangle[(corner + 1) % 3];
+			const std::vector<std::uint32_t>& neighbors = mBorderNeighbors[a];
+			if (std::find(neighbors.begin(), neighbors.end(), b) == neighbors.end()) {
+				continue;
+			}
+			glm::dvec3 edge = glm::dvec3(mPositions[b]) - glm::dvec3(mPositions[a]);
+			glm::dvec3 normal = glm::cross(edge, faceNormal);
+			double length = glm::length(normal);
+			if (length <= 0.0) {
+				continue;
+			}
+			normal /= length;
+			double edgeLength = glm::length(edge);
+			Quadric plane{};
+			plane.AddPlane(normal, -glm::dot(normal, glm::dvec3(mPositions[a])), edgeLength * edgeLength);
+			mQuadrics[a].Add(plane);
+			mQuadrics[b].Add(plane);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void Simplifier::Classify()
+{
+	std::size_t vertexCount = mPositions.size();
+	mKinds.assign(vertexCount, VertexKind::Interior);
+	mBorderNeighbors.assign(vertexCount, {});
+
+	// 같은 서브메시에서 (a, b) 의 반대 방향 (b, a) 가 없으면 열린 모서리다.
+	std::unordered_map<std::uint64_t, int> directedEdges{};
+	auto edgeKey = [vertexCount](std::uint32_t a, std::uint32_t b, std::uint32_t subMesh) {
+		return (static_cast<std::uint64_t>(a) * vertexCount + b) * 64u + (subMesh & 63u);
+	};
+	for (std::size_t t = 0; t < mTriangles.size(); ++t) {
+		if (!mTriangleAlive[t]) {
+			continue;
+		}
+		for (int corner = 0; corner < 3; ++corner) {
+			++directedEdges[edgeKey(mTriangles[t][corner], mTriangles[t][(corner + 1) % 3], mTriangleSubMesh[t])];
+		}
+	}
+	for (std::size_t t = 0; t < mTriangles.size(); ++t) {
+		if (!mTriangleAlive[t]) {
+			continue;
+		}
+		for (int corner = 0; corner < 3; ++corner) {
+			std::uint32_t a = mTriangles[t][corner];
+			std::uint32_t b = mTriangles[t][(corner + 1) % 3];
+			std::uint32_t subMesh = mTriangleSubMesh[t];
+			int forward = directedEdges[edgeKey(a, b, subMesh)];
+			auto backward = directedEdges.find(edgeKey(b, a, subMesh));
+			if (forward == 1 && backward != directedEdges.end() && backward->second == 1) {
+				continue;
+			}
+			if (forward != 1 || backward != directedEdges.end()) {
+				// 같은 모서리를 셋 이상이 쓰는 경우.
+				mKinds[a] = VertexKind::Locked;
+				mKinds[b] = VertexKind::Locked;
+			}
+			mBorderNeighbors[a].push_back(b);
+			mBorderNeighbors[b].push_back(a);
+		}
+	}
+
+	for (std::size_t vertex = 0; vertex < vertexCount; ++vertex) {
+		std::vector<std::uint32_t>& neighbors = mBorderNeighbors[vertex];
+		std::sort(neighbors.begin(), neighbors.end());
+		neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+		if (mKinds[vertex] == VertexKind::Locked) {
+			continue;
+		}
+		if (neighbors.size() == 2) {
+			mKinds[vertex] = VertexKind::Border;
+		}
+		else if (!neighbors.empty()) {
+			mKinds[vertex] = VertexKind::Locked;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool Simplifier::BuildCollapse(std::uint32_t from, std::uint32_t to, std::vector<CollapsePair>& pairs) const
+{
+	pairs.clear();
+	if (mKinds[from] == VertexKind::Locked || mVertexTriangles[from].empty() || mGroups[from] == mGroups[to]) {
+		return false;
+	}
+
+	const std::vector<std::uint32_t>& siblings = mGroupMembers[mGroups[from]];
+	if (mKinds[from] == VertexKind::Interior) {
+		// 같은 위치에 다른 버텍스가 있으면 혼자 움직일 때 표면이 찢어진다.
+		for (std::uint32_t sibling : siblings) {
+			if (sibling != from && !mVertexTriangles[sibling].empty()) {
+				return false;
+			}
+		}
+		pairs.push_back(CollapsePair{ from, to });
+		return true;
+	}
+
+	// 테두리 버텍스는 테두리 모서리를 따라서만 움직인다.
+	const std::vector<std::uint32_t>& neighbors = mBorderNeighbors[from];
+	if (std::find(neighbors.begin(), neighbors.end(), to) == neighbors.end()) {
+		return false;
+	}
+	// UV 이음매 건너편의 같은 위치 버텍스도 같은 방향 테두리 이웃으로 같이 접는다.
+	for (std::uint32_t sibling : siblings) {
+		if (mVertexTriangles[sibling].empty()) {
+			continue;
+		}
+		if (sibling == from) {
+			pairs.push_back(CollapsePair{ from, to });
+			continue;
+		}
+		if (mKinds[sibling] != VertexKind::Border) {
+			return false;
+		}
+		bool paired = false;
+		for (std::uint32_t neighbor : mBorderNeighbors[sibling]) {
+			if (mGroups[neighbor] == mGroups[to]) {
+				pairs.push_back(CollapsePair{ sibling, neighbor });
+				paired = true;
+				break;
+			}
+		}
+		if (!paired) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+double Simplifier::GetCost(const std::vector<CollapsePair>& pairs) const
+{
+	double cost = 0.0;
+	for (const CollapsePair& pair : pairs) {
+		Quadric sum = mQuadrics[pair.from];
+		sum.Add(mQuadrics[pair.to]);
+		cost = std::max(cost, sum.Evaluate(mPositions[pair.to]));
+	}
+	return cost;
+}
+
+//-----------------------------------------------------------------------------
+bool Simplifier::CanCollapse(std::uint32_t from, std::uint32_t to) const
+{
+	// 링크 조건: 두 버텍스의 공통 이웃이 모서리를 낀 삼각형의 맞은편 꼭지점뿐이어야 접은 뒤에도 다양체다.
+	std::vector<std::uint32_t> fromNeighbors{};
+	std::vector<std::uint32_t> toNeighbors{};
+	std::vector<std::uint32_t> opposite{};
+	for (std::uint32_t t : mVertexTriangles[from]) {
+		if (!mTriangleAlive[t]) {
+			continue;
+		}
+		const std::array<std::uint32_t, 3>& triangle = mTriangles[t];
+		fromNeighbors.insert(fromNeighbors.end(), triangle.begin(), triangle.end());
+		if (triangle[0] == to || triangle[1] == to || triangle[2] == to) {
+			for (std::uint32_t vertex : triangle) {
+				if (vertex != from && vertex != to) {
+					opposite.push_back(vertex);
+				}
+			}
+		}
+	}
+	for (std::uint32_t t : mVertexTriangles[to]) {
+		if (mTriangleAlive[t]) {
+			toNeighbors.insert(toNeighbors.end(), mTriangles[t].begin(), mTriangles[t].end());
+		}
+	}
+	if (opposite.empty()) {
+		return false;
+	}
+	std::sort(fromNeighbors.begin(), fromNeighbors.end());
+	fromNeighbors.erase(std::unique(fromNeighbors.begin(), fromNeighbors.end()), fromNeighbors.end());
+	std::sort(toNeighbors.begin(), toNeighbors.end());
+	toNeighbors.erase(std::unique(toNeighbors.begin(), toNeighbors.end()), toNeighbors.end());
+	std::sort(opposite.begin(), opposite.end());
+	opposite.erase(std::unique(opposite.begin(), opposite.end()), opposite.end());
+	std::size_t shared = 0;
+	for (std::uint32_t vertex : fromNeighbors) {
+		if (vertex != from && vertex != to && std::binary_search(toNeighbors.begin(), toNeighbors.end(), vertex)) {
+			++shared;
+		}
+	}
+	if (shared != opposite.size()) {
+		return false;
+	}
+
+	// from 을 to 로 옮겨도 남는 삼각형이 뒤집히거나 납작해지지 않아야 한다.
+	const glm::vec3& target = mPositions[to];
+	for (std::uint32_t t : mVertexTriangles[from]) {
+		if (!mTriangleAlive[t]) {
+			continue;
+		}
+		const std::array<std::uint32_t, 3>& triangle = mTriangles[t];
+		if (triangle[0] == to || triangle[1] == to || triangle[2] == to) {
+			continue;
+		}
+		glm::vec3 before[3];
+		glm::vec3 after[3];
+		for (int corner = 0; corner < 3; ++corner) {
+			before[corner] = mPositions[triangle[corner]];
+			after[corner] = (triangle[corner] == from) ? target : before[corner];
+		}
+		glm::vec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+		glm::vec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+		float lengths = glm::length(normalBefore) * glm::length(normalAfter);
+		if (lengths <= 0.0f || glm::dot(normalBefore, normalAfter) < MAX_FLIP_COS * lengths) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void Simplifier::Collapse(std::uint32_t from, std::uint32_t to)
+{
+	for (std::uint32_t t : mVertexTriangles[from]) {
+		if (!mTriangleAlive[t]) {
+			continue;
+		}
+		std::array<std::uint32_t, 3>& triangle = mTriangles[t];
+		bool hasTarget = (triangle[0] == to || triangle[1] == to || triangle[2] == to);
+		if (hasTarget) {
+			// 접는 모서리에 붙은 삼각형은 없어진다.
+			mTriangleAlive[t] = false;
+			--mAliveTriangleCount;
+			continue;
+		}
+		for (std::uint32_t& vertex : triangle) {
+			if (vertex == from) {
+				vertex = to;
+			}
+		}
+		mVertexTriangles[to].push_back(t);
+	}
+	mVertexTriangles[from].clear();
+	mQuadrics[to].Add(mQuadrics[from]);
+	// 원본과 다른 모양이 된 버텍스의 노멀은 다시 구해야 한다.
+	mHard[to] = mHard[to] || mHard[from];
+}
+
+//-----------------------------------------------------------------------------
+void Simplifier::Run(std::size_t targetTriangleCount, float maxError)
+{
+	struct Candidate
+	{
+		double cost{};
+		std::uint32_t from{};
+		std::uint32_t to{};
+	};
+	double maxCost = static_cast<double>(maxError) * maxError;
+	std::vector<Candidate> candidates{};
+	std::vector<CollapsePair> pairs{};
+	std::vector<bool> touched(mPositions.size(), false);
+
+	// 한 번에 후보를 모두 구해 싼 것부터 접는다.
+	// 접은 버텍스와 그 주변은 종류/테두리 이웃이 바뀌므로 다음 번에 다시 분류한 뒤에 접는다.
+	while (mAliveTriangleCount > targetTriangleCount) {
+		Classify();
+		candidates.clear();
+		for (std::size_t t = 0; t < mTriangles.size(); ++t) {
+			if (!mTriangleAlive[t]) {
+				continue;
+			}
+			for (int corner = 0; corner < 3; ++corner) {
+				std::uint32_t a = mTriangles[t][corner];
+				std::uint32_t b = mTriangles[t][(corner + 1) % 3];
+				if (BuildCollapse(a, b, pairs)) {
+					candidates.push_back(Candidate{ GetCost(pairs), a, b });
+				}
+				if (BuildCollapse(b, a, pairs)) {
+					candidates.push_back(Candidate{ GetCost(pairs), b, a });
+				}
+			}
+		}
+		std::sort(candidates.begin(), candidates.end(), [](const Candidate& left, const Candidate& right) {
+			return left.cost < right.cost;
+		});
+
+		std::fill(touched.begin(), touched.end(), false);
+		std::size_t collapsed = 0;
+		// 한 번에 너무 많이 접으면 비싼 후보까지 가므로 남은 양의 절반까지만 접는다.
+		std::size_t passTarget = std::max(targetTriangleCount, mAliveTriangleCount - (mAliveTriangleCount - targetTriangleCount + 1) / 2);
+		for (const Candidate& candidate : candidates) {
+			if (mAliveTriangleCount <= passTarget || candidate.cost > maxCost) {
+				break;
+			}
+			if (!BuildCollapse(candidate.from, candidate.to, pairs)) {
+				continue;
+			}
+			bool blocked = false;
+			for (const CollapsePair& pair : pairs) {
+				if (touched[pair.from] || touched[pair.to] || !CanCollapse(pair.from, pair.to)) {
+					blocked = true;
+					break;
+				}
+			}
+			if (blocked) {
+				continue;
+			}
+
+			for (const CollapsePair& pair : pairs) {
+				Collapse(pair.from, pair.to);
+				touched[pair.from] = true;
+				// 바뀐 삼각형의 꼭지점들은 이번에는 더 접지 않는다.
+				for (std::uint32_t t : mVertexTriangles[pair.to]) {
+					if (mTriangleAlive[t]) {
+						for (std::uint32_t vertex : mTriangles[t]) {
+							touched[vertex] = true;
+						}
+					}
+				}
+				touched[pair.to] = true;
+			}
+			++collapsed;
+		}
+		if (collapsed == 0) {
+			break;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+float Simplifier::MeasureDeviation() const
+{
+	// 남은 삼각형마다 경계구를 구해 두고, 지금까지 찾은 거리보다 먼 삼각형은 건너뛴다.
+	std::vector<glm::vec4> spheres{};
+	std::vector<std::uint32_t> alive{};
+	for (std::size_t t = 0; t < mTriangles.size(); ++t) {
+		if (!mTriangleAlive[t]) {
+			continue;
+		}
+		const std::array<std::uint32_t, 3>& triangle = mTriangles[t];
+		glm::vec3 center = (mPositions[triangle[0]] + mPositions[triangle[1]] + mPositions[triangle[2]]) / 3.0f;
+		float radius = 0.0f;
+		for (std::uint32_t vertex : triangle) {
+			radius = std::max(radius, glm::length(mPositions[vertex] - center));
+		}
+		spheres.push_back(glm::vec4(center, radius));
+		alive.push_back(static_cast<std::uint32_t>(t));
+	}
+	if (alive.empty()) {
+		return 0.0f;
+	}
+
+	float deviation = 0.0f;
+	for (std::size_t vertex = 0; vertex < mPositions.size(); ++vertex) {
+		if (!mVertexTriangles[vertex].empty()) {
+			continue;
+		}
+		const glm::vec3& point = mPositions[vertex];
+		float best2 = std::numeric_limits<float>::max();
+		float best = std::numeric_limits<float>::max();
+		for (std::size_t i = 0; i < alive.size(); ++i) {
+			float reach = glm::length(point - glm::vec3(spheres[i])) - spheres[i].w;
+			if (reach > best) {
+				continue;
+			}
+			const std::array<std::uint32_t, 3>& triangle = mTriangles[alive[i]];
+			float distance2 = PointTriangleDistance2(point, mPositions[triangle[0]], mPositions[triangle[1]], mPositions[triangle[2]]);
+			if (distance2 < best2) {
+				best2 = distance2;
+				best = std::sqrt(distance2);
+			}
+		}
+		deviation = std::max(deviation, best);
+	}
+	return deviation;
+}
+
+//-----------------------------------------------------------------------------
+void Simplifier::Extract(MeshData& out) const
+{
+	out.name = mSource->name;
+	out.vertices.clear();
+	out.indices.clear();
+	out.subMeshes.assign(mSource->subMeshes.size(), SubMesh{});
+
+	// 부드러운 버텍스는 합친 버텍스 하나, 각진 버텍스는 면마다 버텍스 하나.
+	std::vector<std::uint32_t> smoothVertices(mPositions.size(), 0xFFFFFFFFu);
+	for (std::size_t subMeshIndex = 0; subMeshIndex < mSource->subMeshes.size(); ++subMeshIndex) {
+		out.subMeshes[subMeshIndex].material = mSource->subMeshes[subMeshIndex].material;
+		out.subMeshes[subMeshIndex].indexOffset = static_cast<unsigned int>(out.indices.size());
+		for (std::size_t t = 0; t < mTriangles.size(); ++t) {
+			if (!mTriangleAlive[t] || mTriangleSubMesh[t] != subMeshIndex) {
+				continue;
+			}
+			const std::array<std::uint32_t, 3>& triangle = mTriangles[t];
+			glm::vec3 faceNormal = glm::cross(mPositions[triangle[1]] - mPositions[triangle[0]], mPositions[triangle[2]] - mPositions[triangle[0]]);
+			float length = glm::length(faceNormal);
+			faceNormal = (length > 0.0f) ? faceNormal / length : glm::vec3(0.0f, 1.0f, 0.0f);
+
+			for (std::uint32_t vertex : triangle) {
+				if (!mHard[vertex]) {
+					if (smoothVertices[vertex] == 0xFFFFFFFFu) {
+						smoothVertices[vertex] = static_cast<std::uint32_t>(out.vertices.size());
+						out.vertices.push_back(mSource->vertices[mRepresentative[vertex]]);
+					}
+					out.indices.push_back(smoothVertices[vertex]);
+					continue;
+				}
+				ModelVertex corner = mSource->vertices[mRepresentative[vertex]];
+				corner.mNormal = faceNormal;
+				out.indices.push_back(static_cast<unsigned int>(out.vertices.size()));
+				out.vertices.push_back(corner);
+			}
+		}
+		out.subMeshes[subMeshIndex].indexCount = static_cast<unsigned int>(out.indices.size()) - out.subMeshes[subMeshIndex].indexOffset;
+	}
+}
+
+}
+
+//-----------------------------------------------------------------------------
+// simplifier 를 target 개까지 접는다. 실제로 벗어난 거리(MeasureDeviation)가 maxError 를 넘으면
+// 덜 줄여서 다시 해 보고, 한도 안에서 minTriangleCount 이하로 줄지 않으면 simplifier 를 그대로 두고 false.
+static bool Reduce(Simplifier& simplifier, std::size_t target, std::size_t minTriangleCount, float maxError, float& deviation)
+{
+	std::size_t current = simplifier.GetTriangleCount();
+	for (int attempt = 0; attempt < MAX_REDUCE_ATTEMPTS && target < current; ++attempt) {
+		Simplifier candidate = simplifier;
+		candidate.Run(target, maxError);
+		std::size_t reached = candidate.GetTriangleCount();
+		if (reached > minTriangleCount) {
+			return false;
+		}
+		float measured = candidate.MeasureDeviation();
+		if (measured <= maxError) {
+			simplifier = std::move(candidate);
+			deviation = measured;
+			return true;
+		}
+		// 줄인 양을 반으로 해서 다시.
+		target = reached + (current - reached) / 2;
+	}
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+MeshLod MeshSimplifier::Simplify(const MeshData& mesh, std::size_t targetTriangleCount, float maxError)
+{
+	Simplifier simplifier(mesh);
+	MeshLod lod{};
+	if (!Reduce(simplifier, targetTriangleCount, simplifier.GetTriangleCount(), maxError, lod.error)) {
+		lod.error = 0.0f;
+	}
+	simplifier.Extract(lod.mesh);
+	return lod;
+}
+
+//-----------------------------------------------------------------------------
+void MeshSimplifier::BuildLodChain(const MeshData& mesh, int levelCount, std::vector<MeshLod>& lods)
+{
+	lods.clear();
+	lods.push_back(MeshLod{ mesh, 0.0f });
+	if (levelCount <= 1) {
+		return;
+	}
+
+	// 한 상태를 이어서 접으므로 거친 단계일수록 원본에서 더 벗어난다.
+	// 오차는 원본 버텍스에서 잰 실제 거리라서 화면 픽셀로 투영해도 약속한 만큼만 틀린다.
+	Simplifier simplifier(mesh);
+	std::size_t triangleCount = simplifier.GetTriangleCount();
+	float maxError = simplifier.GetRadius() * LOD_MAX_RELATIVE_ERROR;
+	while (static_cast<int>(lods.size()) < levelCount) {
+		std::size_t target = static_cast<std::size_t>(static_cast<float>(triangleCount) * LOD_REDUCTION);
+		std::size_t minTriangleCount = static_cast<std::size_t>(static_cast<float>(triangleCount) * LOD_MIN_REDUCTION);
+		float deviation = 0.0f;
+		if (!Reduce(simplifier, target, minTriangleCount, maxError, deviation)) {
+			break;
+		}
+		MeshLod lod{};
+		simplifier.Extract(lod.mesh);
+		lod.error = deviation;
+		triangleCount = simplifier.GetTriangleCount();
+		// 오차가 앞 단계보다 늘지 않았으면 앞 단계는 고를 일이 없다. (같은 오차라면 더 거친 쪽이 뽑힌다)
+		// 그 자리를 더 거친 단계로 바꿔서 단계마다 오차가 서로 다르고 커지게 한다.
+		if (lods.size() > 1 && deviation <= lods.back().error) {
+			lod.error = lods.back().error;
+			lods.back() = std::move(lod);
+			continue;
+		}
+		lods.push_back(std::move(lod));
+	}
+}
+
+//-----------------------------------------------------------------------------
+float MeshSimplifier::ProjectError(float error, float distance, float viewportHeight, float fovY)
+{
+	float projection = viewportHeight / (2.0f * std::tan(fovY * 0.5f));
+	return error * projection / std::max(distance, 1e-4f);
+}
+
+//-----------------------------------------------------------------------------
+int MeshSimplifier::SelectLod(const std::vector<MeshLod>& lods, float distance, float viewportHeight, float fovY, float maxPixelError)
+{
+	int selected = 0;
+	for (std::size_t level = 1; level < lods.size(); ++level) {
+		if (ProjectError(lods[level].error, distance, viewportHeight, fovY) > maxPixelError) {
+			break;
+		}
+		selected = static_cast<int>(level);
+	}
+	return selected;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include "mesh/MeshData.h"
+
+// 메시 하나의 LOD 단계.
+// error 는 접혀서 없어진 원본 버텍스에서 이 단계의 표면까지 잰 최대 거리(모델 공간)다.
+// 화면에 투영해서 LOD 를 고를 때 쓴다. 체인에서는 단계가 오를수록 줄지 않는다.
+struct MeshLod
+{
+	MeshData mesh{};
+	float error{};
+};
+
+// Quadric Error Metric(Garland & Heckbert 1997) 으로 모서리를 접어서 LOD 를 만든다.
+// 위치/uv/색상이 같은 버텍스를 하나로 보고 접는다. (노멀만 다른 버텍스는 같은 버텍스)
+// 열린 모서리(UV 이음매, 재질 경계, 메시 테두리)의 버텍스는 테두리를 따라서만 접고,
+// 이음매 건너편의 같은 위치 버텍스도 같이 접어서 틈이 생기지 않게 한다. 테두리가 갈라지는 곳은 움직이지 않는다.
+// 접은 뒤의 노멀은 원래 부드러웠던 버텍스는 원래 노멀을, 각진 버텍스(s off 로 내보낸 면 노멀 등)는 새 면 노멀을 쓴다.
+namespace MeshSimplifier
+{
+	// 한 단계마다 삼각형 수를 이 비율로 줄인다.
+	constexpr float LOD_REDUCTION = 0.5f;
+	// 이보다 적게 줄어들면 더 접을 모서리가 없다고 보고 멈춘다.
+	constexpr float LOD_MIN_REDUCTION = 0.9f;
+	// 모델 경계구 반지름 대비 이보다 크게 벗어나는 단계는 만들지 않는다. (모양이 무너지기 전에 멈춘다)
+	constexpr float LOD_MAX_RELATIVE_ERROR = 0.05f;
+
+	// 삼각형이 targetTriangleCount 개가 될 때까지 (또는 잰 오차가 maxError 안에서 더 접을 수 없을 때까지) 접는다.
+	// 서브메시 개수와 재질은 원본과 같다.
+	MeshLod Simplify(const MeshData& mesh, std::size_t targetTriangleCount, float maxError);
+
+	// 원본(0단계)부터 최대 levelCount 단계까지 만든다. 다음 단계는 앞 단계보다 LOD_REDUCTION 배 적다.
+	// 더 줄어들지 않으면 levelCount 보다 적게 만든다.
+	void BuildLodChain(const MeshData& mesh, int levelCount, std::vector<MeshLod>& lods);
+
+	// 오차를 화면 높이 기준 픽셀로 투영한다. fovY 는 라디안.
+	float ProjectError(float error, float distance, float viewportHeight, float fovY);
+	// 투영한 오차가 maxPixelError 이하인 가장 거친 단계를 고른다.
+	int SelectLod(const std::vector<MeshLod>& lods, float distance, float viewportHeight, float fovY, float maxPixelError);
+}
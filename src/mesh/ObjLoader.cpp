@@ -0,0 +1,276 @@
+#include "mesh/ObjLoader.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+
+namespace {
+
+// 면의 꼭지점 하나가 가리키는 (위치, uv, 노멀) 번호. 없으면 -1.
+struct CornerKey
+{
+	int position{ -1 };
+	int uv{ -1 };
+	int normal{ -1 };
+
+	bool operator==(const CornerKey& other) const {
+		return position == other.position && uv == other.uv && normal == other.normal;
+	}
+};
+
+struct CornerKeyHash
+{
+	std::size_t operator()(const CornerKey& key) const {
+		std::size_t hash = static_cast<std::size_t>(key.position) * 73856093u;
+		hash ^= static_cast<std::size_t>(key.uv) * 19349663u;
+		hash ^= static_cast<std::size_t>(key.normal) * 83492791u;
+		return hash;
+	}
+};
+
+const char* SkipSpaces(const char* cursor, const char* end)
+{
+	while (cursor < end && (*cursor == ' ' || *cursor == '\t')) {
+		++cursor;
+	}
+	return cursor;
+}
+
+const char* SkipLine(const char* cursor, const char* end)
+{
+	while (cursor < end && *cursor != '\n') {
+		++cursor;
+	}
+	return (cursor < end) ? cursor + 1 : end;
+}
+
+bool IsTokenEnd(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// [cursor, end) 안에서만 읽는다. text 가 NUL 로 끝나지 않아도 되고, 줄이 모자라도 다음 줄로 넘어가지 않는다.
+// 토큰을 NUL 로 끝나는 지역 버퍼에 복사해서 strtof 에 넘긴다. (값이 없으면 0)
+float ParseFloat(const char*& cursor, const char* end)
+{
+	cursor = SkipSpaces(cursor, end);
+	char token[64]{};
+	std::size_t length = 0;
+	while (cursor < end && !IsTokenEnd(*cursor)) {
+		if (length + 1 < sizeof(token)) {
+			token[length++] = *cursor;
+		}
+		++cursor;
+	}
+	return std::strtof(token, nullptr);
+}
+
+// 면 꼭지점의 번호 하나. [cursor, end) 안의 부호와 숫자만 읽는다. (숫자가 없으면 0)
+long ParseIndex(const char*& cursor, const char* end)
+{
+	bool negative = false;
+	if (cursor < end && (*cursor == '-' || *cursor == '+')) {
+		negative = (*cursor == '-');
+		++cursor;
+	}
+	long value = 0;
+	while (cursor < end && *cursor >= '0' && *cursor <= '9') {
+		value = value * 10 + (*cursor - '0');
+		++cursor;
+	}
+	return negative ? -value : value;
+}
+
+// OBJ 번호는 1부터 시작하고, 음수면 지금까지 나온 개수 기준 상대 번호다.
+int ResolveIndex(long index, std::size_t count)
+{
+	if (index > 0) {
+		return static_cast<int>(index - 1);
+	}
+	if (index < 0) {
+		return static_cast<int>(static_cast<long>(count) + index);
+	}
+	return -1;
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+bool ObjLoader::Load(const std::string& path, MeshData& mesh)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		std::cout << "Failed to open obj file: " << path << std::endl;
+		return false;
+	}
+
+	std::stringstream buffer{};
+	buffer << file.rdbuf();
+	std::string text = buffer.str();
+
+	mesh.name = path;
+	return Parse(text.data(), text.size(), mesh);
+}
+
+//-----------------------------------------------------------------------------
+bool ObjLoader::Parse(const char* text, std::size_t length, MeshData& mesh)
+{
+	std::vector<glm::vec3> positions{};
+	std::vector<glm::vec2> uvs{};
+	std::vector<glm::vec3> normals{};
+	std::unordered_map<CornerKey, unsigned int, CornerKeyHash> vertexLookup{};
+	std::vector<unsigned int> face{};
+	bool hasNormals = true;
+
+	mesh.vertices.clear();
+	mesh.indices.clear();
+	mesh.subMeshes.clear();
+	mesh.subMeshes.push_back(SubMesh{});
+
+	const char* cursor = text;
+	const char* end = text + length;
+	while (cursor < end) {
+		cursor = SkipSpaces(cursor, end);
+		if (cursor >= end) {
+			break;
+		}
+
+		if (cursor[0] == 'v' && cursor + 1 < end && cursor[1] == ' ') {
+			cursor += 2;
+			glm::vec3 position{};
+			position.x = ParseFloat(cursor, end);
+			position.y = ParseFloat(cursor, end);
+			position.z = ParseFloat(cursor, end);
+			positions.push_back(position);
+		}
+		else if (cursor[0] == 'v' && cursor + 2 < end && cursor[1] == 't' && cursor[2] == ' ') {
+			cursor += 3;
+			glm::vec2 uv{};
+			uv.x = ParseFloat(cursor, end);
+			uv.y = ParseFloat(cursor, end);
+			uvs.push_back(uv);
+		}
+		else if (cursor[0] == 'v' && cursor + 2 < end && cursor[1] == 'n' && cursor[2] == ' ') {
+			cursor += 3;
+			glm::vec3 normal{};
+			normal.x = ParseFloat(cursor, end);
+			normal.y = ParseFloat(cursor, end);
+			normal.z = ParseFloat(cursor, end);
+			normals.push_back(normal);
+		}
+		else if (cursor[0] == 'f' && cursor + 1 < end && cursor[1] == ' ') {
+			cursor += 2;
+			face.clear();
+
+			// "v", "v/vt", "v//vn", "v/vt/vn" 형식의 꼭지점들을 줄 끝까지 읽는다.
+			while (true) {
+				cursor = SkipSpaces(cursor, end);
+				if (cursor >= end || *cursor == '\r' || *cursor == '\n') {
+					break;
+				}
+
+				CornerKey key{};
+				key.position = ResolveIndex(ParseIndex(cursor, end), positions.size());
+				if (cursor < end && *cursor == '/') {
+					++cursor;
+					if (cursor < end && *cursor != '/') {
+						key.uv = ResolveIndex(ParseIndex(cursor, end), uvs.size());
+					}
+					if (cursor < end && *cursor == '/') {
+						++cursor;
+						key.normal = ResolveIndex(ParseIndex(cursor, end), normals.size());
+					}
+				}
+
+				if (key.position < 0 || key.position >= static_cast<int>(positions.size())) {
+					std::cout << "[ObjLoader] invalid face index" << std::endl;
+					return false;
+				}
+
+				// 처음 나온 조합이면 새 버텍스를 만든다.
+				auto found = vertexLookup.find(key);
+				if (found == vertexLookup.end()) {
+					ModelVertex vertex{};
+					vertex.mPosition = positions[key.position];
+					if (key.uv >= 0 && key.uv < static_cast<int>(uvs.size())) {
+						vertex.mUv = uvs[key.uv];
+					}
+					if (key.normal >= 0 && key.normal < static_cast<int>(normals.size())) {
+						vertex.mNormal = normals[key.normal];
+					}
+					else {
+						hasNormals = false;
+					}
+					unsigned int index = static_cast<unsigned int>(mesh.vertices.size());
+					mesh.vertices.push_back(vertex);
+					found = vertexLookup.emplace(key, index).first;
+				}
+				face.push_back(found->second);
+			}
+
+			// 부채꼴 삼각형 분할.
+			for (std::size_t i = 2; i < face.size(); ++i) {
+				mesh.indices.push_back(face[0]);
+				mesh.indices.push_back(face[i - 1]);
+				mesh.indices.push_back(face[i]);
+			}
+		}
+		else if (end - cursor > 7 && std::strncmp(cursor, "usemtl ", 7) == 0) {
+			cursor += 7;
+			const char* nameStart = SkipSpaces(cursor, end);
+			const char* nameEnd = nameStart;
+			while (nameEnd < end && *nameEnd != '\r' && *nameEnd != '\n') {
+				++nameEnd;
+			}
+
+			// 재질이 바뀌면 새 구간을 시작한다.
+			SubMesh& current = mesh.subMeshes.back();
+			current.indexCount = static_cast<unsigned int>(mesh.indices.size()) - current.indexOffset;
+			SubMesh next{};
+			next.material = std::string(nameStart, nameEnd);
+			next.indexOffset = static_cast<unsigned int>(mesh.indices.size());
+			mesh.subMeshes.push_back(next);
+			cursor = nameEnd;
+		}
+
+		cursor = SkipLine(cursor, end);
+	}
+
+	SubMesh& last = mesh.subMeshes.back();
+	last.indexCount = static_cast<unsigned int>(mesh.indices.size()) - last.indexOffset;
+
+	// 빈 구간은 버린다.
+	std::vector<SubMesh> subMeshes{};
+	for (const SubMesh& subMesh : mesh.subMeshes) {
+		if (subMesh.indexCount > 0) {
+			subMeshes.push_back(subMesh);
+		}
+	}
+	mesh.subMeshes = std::move(subMeshes);
+
+	// 노멀이 없는 버텍스가 있으면 면 노멀을 누적해서 만든다.
+	if (!hasNormals) {
+		for (ModelVertex& vertex : mesh.vertices) {
+			vertex.mNormal = glm::vec3(0.0f);
+		}
+		for (std::size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+			ModelVertex& a = mesh.vertices[mesh.indices[i]];
+			ModelVertex& b = mesh.vertices[mesh.indices[i + 1]];
+			ModelVertex& c = mesh.vertices[mesh.indices[i + 2]];
+			glm::vec3 faceNormal = glm::cross(b.mPosition - a.mPosition, c.mPosition - a.mPosition);
+			a.mNormal += faceNormal;
+			b.mNormal += faceNormal;
+			c.mNormal += faceNormal;
+		}
+		for (ModelVertex& vertex : mesh.vertices) {
+			float length2 = glm::dot(vertex.mNormal, vertex.mNormal);
+			vertex.mNormal = (length2 > 0.0f) ? vertex.mNormal / std::sqrt(length2) : glm::vec3(0, 1, 0);
+		}
+	}
+
+	return true;
+}
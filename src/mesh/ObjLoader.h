@@ -0,0 +1,15 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+#include "mesh/MeshData.h"
+
+// Wavefront OBJ 로더.
+// v / vt / vn / f / usemtl 을 읽어서, 같은 (위치, uv, 노멀) 조합은 버텍스 하나로 합치고
+// 다각형 면은 부채꼴로 삼각형 분할한다. usemtl 이 바뀔 때마다 SubMesh 를 나눈다.
+namespace ObjLoader
+{
+	bool Load(const std::string& path, MeshData& mesh);
+	// text 는 NUL 로 끝나지 않아도 된다. [text, text + length) 밖은 읽지 않는다.
+	bool Parse(const char* text, std::size_t length, MeshData& mesh);
+}
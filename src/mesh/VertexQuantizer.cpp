@@ -0,0 +1,131 @@
+#include "mesh/VertexQuantizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "glm/gtc/matrix_transform.hpp"
+#include "glm/gtc/packing.hpp"
+
+namespace {
+
+// 경계 상자 크기가 0인 축(평면 모델 등)도 나눌 수 있게 한다.
+const float MIN_EXTENT = 1e-6f;
+
+}
+
+//-----------------------------------------------------------------------------
+glm::mat4 QuantizedMesh::GetDequantizeMatrix() const
+{
+	return glm::scale(glm::translate(glm::mat4(1.0f), boundsCenter), boundsExtent);
+}
+
+//-----------------------------------------------------------------------------
+QuantizedModelVertex VertexQuantizer::Encode(const ModelVertex& vertex, const glm::vec3& boundsCenter, const glm::vec3& boundsExtent)
+{
+	QuantizedModelVertex result{};
+
+	glm::vec3 position = (vertex.mPosition - boundsCenter) / boundsExtent;
+	result.mPosition.x = static_cast<std::int16_t>(glm::packSnorm1x16(position.x));
+	result.mPosition.y = static_cast<std::int16_t>(glm::packSnorm1x16(position.y));
+	result.mPosition.z = static_cast<std::int16_t>(glm::packSnorm1x16(position.z));
+
+	glm::vec3 color = glm::clamp(vertex.mColor, glm::vec3(0.0f), glm::vec3(1.0f));
+	result.mColor.x = glm::packUnorm1x8(color.r);
+	result.mColor.y = glm::packUnorm1x8(color.g);
+	result.mColor.z = glm::packUnorm1x8(color.b);
+	result.mColor.w = 255;
+
+	// 노멀이 없는 버텍스(0 벡터)는 그대로 0 이다.
+	glm::vec3 normal = vertex.mNormal;
+	float length = glm::length(normal);
+	if (length > 0.0f) {
+		normal /= length;
+	}
+	result.mNormal.packed = glm::packSnorm3x10_1x2(glm::vec4(normal, 0.0f));
+
+	result.mUv.x = glm::packHalf1x16(vertex.mUv.x);
+	result.mUv.y = glm::packHalf1x16(vertex.mUv.y);
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+ModelVertex VertexQuantizer::Decode(const QuantizedModelVertex& vertex, const glm::vec3& boundsCenter, const glm::vec3& boundsExtent)
+{
+	ModelVertex result{};
+
+	// GL 과 같은 변환. (-32768 은 -1 로 자른다)
+	glm::vec3 position(
+		glm::unpackSnorm1x16(static_cast<glm::uint16>(vertex.mPosition.x)),
+		glm::unpackSnorm1x16(static_cast<glm::uint16>(vertex.mPosition.y)),
+		glm::unpackSnorm1x16(static_cast<glm::uint16>(vertex.mPosition.z)));
+	result.mPosition = boundsCenter + position * boundsExtent;
+
+	result.mColor = glm::vec3(
+		glm::unpackUnorm1x8(vertex.mColor.x),
+		glm::unpackUnorm1x8(vertex.mColor.y),
+		glm::unpackUnorm1x8(vertex.mColor.z));
+	result.mNormal = glm::vec3(glm::unpackSnorm3x10_1x2(vertex.mNormal.packed));
+	result.mUv = glm::vec2(glm::unpackHalf1x16(vertex.mUv.x), glm::unpackHalf1x16(vertex.mUv.y));
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+void VertexQuantizer::Quantize(const MeshData& mesh, QuantizedMesh& result)
+{
+	glm::vec3 minimum(0.0f);
+	glm::vec3 maximum(0.0f);
+	if (!mesh.vertices.empty()) {
+		minimum = maximum = mesh.vertices[0].mPosition;
+		for (const ModelVertex& vertex : mesh.vertices) {
+			minimum = glm::min(minimum, vertex.mPosition);
+			maximum = glm::max(maximum, vertex.mPosition);
+		}
+	}
+	result.boundsCenter = (minimum + maximum) * 0.5f;
+	result.boundsExtent = glm::max((maximum - minimum) * 0.5f, glm::vec3(MIN_EXTENT));
+
+	result.vertices.clear();
+	result.vertices.reserve(mesh.vertices.size());
+	for (const ModelVertex& vertex : mesh.vertices) {
+		result.vertices.push_back(Encode(vertex, result.boundsCenter, result.boundsExtent));
+	}
+	result.indices = mesh.indices;
+	result.subMeshes = mesh.subMeshes;
+}
+
+//-----------------------------------------------------------------------------
+QuantizationError VertexQuantizer::Measure(const MeshData& mesh, const QuantizedMesh& quantized)
+{
+	QuantizationError error{};
+	std::size_t count = std::min(mesh.vertices.size(), quantized.vertices.size());
+	if (count == 0) {
+		return error;
+	}
+
+	double positionSum = 0.0;
+	float normalMinCos = 1.0f;
+	for (std::size_t i = 0; i < count; ++i) {
+		const ModelVertex& original = mesh.vertices[i];
+		ModelVertex decoded = Decode(quantized.vertices[i], quantized.boundsCenter, quantized.boundsExtent);
+
+		float positionError = glm::length(decoded.mPosition - original.mPosition);
+		error.positionMax = std::max(error.positionMax, positionError);
+		positionSum += positionError;
+
+		float originalLength = glm::length(original.mNormal);
+		float decodedLength = glm::length(decoded.mNormal);
+		if (originalLength > 0.0f && decodedLength > 0.0f) {
+			float cosine = glm::dot(original.mNormal / originalLength, decoded.mNormal / decodedLength);
+			normalMinCos = std::min(normalMinCos, cosine);
+		}
+
+		glm::vec2 uvError = glm::abs(decoded.mUv - original.mUv);
+		error.uvMax = std::max(error.uvMax, std::max(uvError.x, uvError.y));
+
+		glm::vec3 colorError = glm::abs(decoded.mColor - glm::clamp(original.mColor, glm::vec3(0.0f), glm::vec3(1.0f)));
+		error.colorMax = std::max(error.colorMax, std::max(colorError.x, std::max(colorError.y, colorError.z)));
+	}
+	error.positionMean = static_cast<float>(positionSum / static_cast<double>(count));
+	error.normalMaxDegrees = glm::degrees(std::acos(glm::clamp(normalMinCos, -1.0f, 1.0f)));
+	return error;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "mesh/MeshData.h"
+
+// 압축한 메시. 인덱스와 서브메시는 원본 그대로다.
+struct QuantizedMesh
+{
+	std::vector<QuantizedModelVertex> vertices{};
+	std::vector<unsigned int> indices{};
+	std::vector<SubMesh> subMeshes{};
+
+	// 위치 복원용 경계 상자. 원래 위치 = boundsCenter + snorm * boundsExtent.
+	glm::vec3 boundsCenter{ 0.0f };
+	glm::vec3 boundsExtent{ 1.0f };
+
+	// 모델 행렬 오른쪽에 곱하는 복원 행렬. (노멀 행렬에는 넣지 않는다)
+	glm::mat4 GetDequantizeMatrix() const;
+};
+
+// 압축으로 생긴 오차. 위치는 모델 공간 거리, 노멀은 각도(도)다.
+struct QuantizationError
+{
+	float positionMax{};
+	float positionMean{};
+	float normalMaxDegrees{};
+	float uvMax{};
+	float colorMax{};
+};
+
+// ModelVertex 를 QuantizedModelVertex 로 바꾼다. 로드(쿡) 시점에 한 번 한다.
+// 위치 16비트 snorm(경계 상자 기준), 노멀 2_10_10_10, uv half, 색상 8비트 unorm.
+namespace VertexQuantizer
+{
+	void Quantize(const MeshData& mesh, QuantizedMesh& result);
+	// 압축을 다시 풀어서 원본과 비교한다.
+	QuantizationError Measure(const MeshData& mesh, const QuantizedMesh& quantized);
+
+	QuantizedModelVertex Encode(const ModelVertex& vertex, const glm::vec3& boundsCenter, const glm::vec3& boundsExtent);
+	ModelVertex Decode(const QuantizedModelVertex& vertex, const glm::vec3& boundsCenter, const glm::vec3& boundsExtent);
+}
@@ -0,0 +1,296 @@
+#include "render/GlState.h"
+
+#include "glad/glad.h"
+
+namespace {
+
+constexpr unsigned int TEXTURE_UNIT_COUNT = 16;
+constexpr unsigned int UNIFORM_BINDING_COUNT = 16;
+constexpr int UNKNOWN = -1;
+
+// 모르는 값은 known = false 로 둔다. (처음이거나 Invalidate 뒤)
+struct Binding
+{
+	unsigned int value{};
+	bool known{};
+};
+
+struct BufferRange
+{
+	unsigned int buffer{};
+	std::intptr_t offset{};
+	std::intptr_t size{};
+	bool known{};
+};
+
+struct TextureUnit
+{
+	unsigned int target{};
+	unsigned int texture{};
+	bool known{};
+};
+
+struct Capability
+{
+	GLenum name;
+	int enabled;
+};
+
+struct State
+{
+	Binding program{};
+	Binding vertexArray{};
+	Binding arrayBuffer{};
+	Binding uniformBuffer{};
+	BufferRange uniformBindings[UNIFORM_BINDING_COUNT]{};
+	Binding activeTexture{};
+	TextureUnit textureUnits[TEXTURE_UNIT_COUNT]{};
+	Capability capabilities[5]{
+		{ GL_BLEND, UNKNOWN }, { GL_DEPTH_TEST, UNKNOWN }, { GL_CULL_FACE, UNKNOWN },
+		{ GL_SCISSOR_TEST, UNKNOWN }, { GL_STENCIL_TEST, UNKNOWN }
+	};
+	Binding blendSource{};
+	Binding blendDestination{};
+	Binding depthFunction{};
+	Binding depthMask{};
+
+	GlState::Stats stats{};
+};
+
+thread_local State gState{};
+
+//-----------------------------------------------------------------------------
+// 값이 같으면 false(거름), 다르면 기억하고 true(보냄).
+bool Update(Binding& binding, unsigned int value)
+{
+	if (binding.known && binding.value == value) {
+		++gState.stats.filtered;
+		return false;
+	}
+	binding.value = value;
+	binding.known = true;
+	++gState.stats.issued;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+Binding* FindBufferBinding(GLenum target)
+{
+	switch (target) {
+	case GL_ARRAY_BUFFER:	return &gState.arrayBuffer;
+	case GL_UNIFORM_BUFFER:	return &gState.uniformBuffer;
+	default:				return nullptr;
+	}
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+void GlState::Invalidate()
+{
+	Stats stats = gState.stats;
+	gState = State{};
+	gState.stats = stats;
+}
+
+//-----------------------------------------------------------------------------
+void GlState::UseProgram(unsigned int program)
+{
+	if (Update(gState.program, program)) {
+		glUseProgram(program);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void GlState::ForgetProgram(unsigned int program)
+{
+	if (gState.program.value == program) {
+		gState.program.known = false;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void GlState::BindVertexArray(unsigned int vertexArray)
+{
+	if (Update(gState.vertexArray, vertexArray)) {
+		glBindVertexArray(vertexArray);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void GlState::BindBuffer(unsigned int target, unsigned int buffer)
+{
+	Binding* binding = FindBufferBinding(target);
+	if (binding == nullptr) {
+		++gState.stats.issued;
+		glBindBuffer(target, buffer);
+		return;
+	}
+	if (Update(*binding, buffer)) {
+		glBindBuffer(target, buffer);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void GlState::BindBufferBase(unsigned int target, unsigned int index, unsigned int buffer)
+{
+	// glBindBufferBase 는 전역 바인딩도 바꾼다.
+	if (Binding* binding = FindBufferBinding(target)) {
+		binding->value = buffer;
+		binding->known = true;
+	}
+	if (target != GL_UNIFORM_BUFFER || index >= UNIFORM_BINDING_COUNT) {
+		++gState.stats.issued;
+		glBindBufferBase(target, index, buffer);
+		return;
+	}
+
+	// 범위를 모르면 (-1, -1) 로 두어 다음 BindBufferRange 는 항상 보낸다.
+	BufferRange& range = gState.uniformBindings[index];
+	if (range.known && range.buffer == buffer && range.offset == 0 && range.size == -1) {
+		++gState.stats.filtered;
+		return;
+	}
+	range = BufferRange{ buffer, 0, -1, true };
+	++gState.stats.issued;
+	glBindBufferBase(target, index, buffer);
+}
+
+//-----------------------------------------------------------------------------
+void GlState::BindBufferRange(unsigned int target, unsigned int index, unsigned int buffer, std::intptr_t offset, std::intptr_t size)
+{
+	if (Binding* binding = FindBufferBinding(target)) {
+		binding->value = buffer;
+		binding->known = true;
+	}
+	if (target != GL_UNIFORM_BUFFER || index >= UNIFORM_BINDING_COUNT) {
+		++gState.stats.issued;
+		glBindBufferRange(target, index, buffer, offset, size);
+		return;
+	}
+
+	BufferRange& range = gState.uniformBindings[index];
+	if (range.known && range.buffer == buffer && range.offset == offset && range.size == size) {
+		++gState.stats.filtered;
+		return;
+	}
+	range = BufferRange{ buffer, offset, size, true };
+	++gState.stats.issued;
+	glBindBufferRange(target, index, buffer, offset, size);
+}
+
+//-----------------------------------------------------------------------------
+void GlState::ForgetBuffer(unsigned int buffer)
+{
+	if (gState.arrayBuffer.value == buffer) {
+		gState.arrayBuffer.known = false;
+	}
+	if (gState.uniformBuffer.value == buffer) {
+		gState.uniformBuffer.known = false;
+	}
+	for (BufferRange& range : gState.uniformBindings) {
+		if (range.buffer == buffer) {
+			range.known = false;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void GlState::BindTexture(unsigned int unit, unsigned int target, unsigned int texture)
+{
+	if (unit >= TEXTURE_UNIT_COUNT) {
+		gState.activeTexture.known = false;
+		gState.stats.issued += 2;
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(target, texture);
+		return;
+	}
+
+	TextureUnit& slot = gState.textureUnits[unit];
+	if (slot.known && slot.target == target && slot.texture == texture) {
+		++gState.stats.filtered;
+		return;
+	}
+	if (Update(gState.activeTexture, unit)) {
+		glActiveTexture(GL_TEXTURE0 + unit);
+	}
+	slot = TextureUnit{ target, texture, true };
+	++gState.stats.issued;
+	glBindTexture(target, texture);
+}
+
+//-----------------------------------------------------------------------------
+void GlState::ForgetTexture(unsigned int texture)
+{
+	for (TextureUnit& slot : gState.textureUnits) {
+		if (slot.texture == texture) {
+			slot.known = false;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void GlState::SetEnabled(unsigned int capability, bool enabled)
+{
+	for (Capability& state : gState.capabilities) {
+		if (state.name != capability) {
+			continue;
+		}
+		if (state.enabled == static_cast<int>(enabled)) {
+			++gState.stats.filtered;
+			return;
+		}
+		state.enabled = static_cast<int>(enabled);
+		break;
+	}
+
+	++gState.stats.issued;
+	if (enabled) {
+		glEnable(capability);
+	}
+	else {
+		glDisable(capability);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void GlState::BlendFunc(unsigned int source, unsigned int destination)
+{
+	if (gState.blendSource.known && gState.blendDestination.known
+		&& gState.blendSource.value == source && gState.blendDestination.value == destination) {
+		++gState.stats.filtered;
+		return;
+	}
+	gState.blendSource = Binding{ source, true };
+	gState.blendDestination = Binding{ destination, true };
+	++gState.stats.issued;
+	glBlendFunc(source, destination);
+}
+
+//-----------------------------------------------------------------------------
+void GlState::DepthFunc(unsigned int function)
+{
+	if (Update(gState.depthFunction, function)) {
+		glDepthFunc(function);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void GlState::DepthMask(bool write)
+{
+	if (Update(gState.depthMask, write ? 1u : 0u)) {
+		glDepthMask(write ? GL_TRUE : GL_FALSE);
+	}
+}
+
+//-----------------------------------------------------------------------------
+const GlState::Stats& GlState::GetStats()
+{
+	return gState.stats;
+}
+
+//-----------------------------------------------------------------------------
+void GlState::ResetStats()
+{
+	gState.stats = Stats{};
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+
+// 바인딩과 고정 기능 상태를 흉내 내서 같은 값으로 다시 부르는 GL 호출을 걸러내는 층.
+// 현재 스레드의 GL 컨텍스트 상태를 thread_local 로 기억하므로 렌더링하는 스레드에서만 부른다.
+// 여기를 거치지 않고 GL 을 직접 바꾼 뒤에는 Invalidate() 해야 한다. (다음 호출은 무조건 보낸다)
+// 지운 프로그램/버퍼/텍스처 이름은 다시 쓰일 수 있으므로 지울 때도 Invalidate 하거나 Forget* 을 부른다.
+namespace GlState
+{
+	// 보낸 호출과 걸러낸 호출 수.
+	struct Stats
+	{
+		std::uint64_t issued{};
+		std::uint64_t filtered{};
+	};
+
+	// 모든 상태를 모르는 것으로 돌린다.
+	void Invalidate();
+
+	void UseProgram(unsigned int program);
+	void ForgetProgram(unsigned int program);
+	void BindVertexArray(unsigned int vertexArray);
+
+	// GL_ARRAY_BUFFER, GL_UNIFORM_BUFFER 등 전역 바인딩만 거른다.
+	// GL_ELEMENT_ARRAY_BUFFER 는 VAO 에 속한 상태라서 거르지 않고 그대로 보낸다.
+	void BindBuffer(unsigned int target, unsigned int buffer);
+	// 인덱스 바인딩 위치. (지금은 GL_UNIFORM_BUFFER 만 거른다)
+	void BindBufferBase(unsigned int target, unsigned int index, unsigned int buffer);
+	void BindBufferRange(unsigned int target, unsigned int index, unsigned int buffer, std::intptr_t offset, std::intptr_t size);
+	void ForgetBuffer(unsigned int buffer);
+
+	// 텍스처 유닛 unit 에 texture 를 붙인다. 필요할 때만 glActiveTexture 를 부른다.
+	void BindTexture(unsigned int unit, unsigned int target, unsigned int texture);
+	void ForgetTexture(unsigned int texture);
+
+	// GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST, GL_STENCIL_TEST 를 거른다. 나머지는 그대로 보낸다.
+	void SetEnabled(unsigned int capability, bool enabled);
+	void BlendFunc(unsigned int source, unsigned int destination);
+	void DepthFunc(unsigned int function);
+	void DepthMask(bool write);
+
+	const Stats& GetStats();
+	void ResetStats();
+}
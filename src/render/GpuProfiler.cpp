@@ -0,0 +1,178 @@
+#include "render/GpuProfiler.h"
+
+#include <algorithm>
+
+#include "glad/glad.h"
+
+//-----------------------------------------------------------------------------
+GpuProfiler::GpuProfiler()
+{
+}
+
+//-----------------------------------------------------------------------------
+GpuProfiler::~GpuProfiler()
+{
+}
+
+//-----------------------------------------------------------------------------
+void GpuProfiler::Initialize()
+{
+	if (mInitialized) {
+		return;
+	}
+
+	for (FrameSlot& slot : mSlots) {
+		glGenQueries(MAX_ZONES_PER_FRAME * 2, slot.queries);
+		slot.zones.reserve(MAX_ZONES_PER_FRAME);
+		slot.queryCount = 0;
+		slot.pending = false;
+	}
+	mInitialized = true;
+}
+
+//-----------------------------------------------------------------------------
+void GpuProfiler::Shutdown()
+{
+	if (!mInitialized) {
+		return;
+	}
+
+	for (FrameSlot& slot : mSlots) {
+		glDeleteQueries(MAX_ZONES_PER_FRAME * 2, slot.queries);
+		slot.zones.clear();
+		slot.pending = false;
+	}
+	mCurrent = nullptr;
+	mInitialized = false;
+}
+
+//-----------------------------------------------------------------------------
+void GpuProfiler::SetResultCallback(ResultCallback callback)
+{
+	mResultCallback = std::move(callback);
+}
+
+//-----------------------------------------------------------------------------
+void GpuProfiler::BeginFrame(std::int64_t frameIndex)
+{
+	if (!mInitialized) {
+		return;
+	}
+
+	// 결과를 기다리는 프레임들을 오래된 순서대로 확인한다.
+	// 앞 프레임이 아직 안 끝났으면 뒤 프레임도 안 끝났으므로 거기서 멈춘다.
+	FrameSlot* pendingSlots[FRAME_LATENCY]{};
+	int pendingCount = 0;
+	for (FrameSlot& slot : mSlots) {
+		if (slot.pending) {
+			pendingSlots[pendingCount++] = &slot;
+		}
+	}
+	std::sort(pendingSlots, pendingSlots + pendingCount, [](const FrameSlot* a, const FrameSlot* b) {
+		return a->frameIndex < b->frameIndex;
+	});
+	for (int i = 0; i < pendingCount; ++i) {
+		if (!CollectSlot(*pendingSlots[i])) {
+			break;
+		}
+	}
+
+	// 이번 프레임이 쓸 쿼리 풀. GPU 가 FRAME_LATENCY 프레임 넘게 밀려 있으면
+	// 쿼리를 덮어쓸 수 없으므로 이번 프레임은 측정을 건너뛴다.
+	FrameSlot& slot = mSlots[frameIndex % FRAME_LATENCY];
+	if (slot.pending) {
+		mCurrent = nullptr;
+		return;
+	}
+
+	slot.zones.clear();
+	slot.queryCount = 0;
+	slot.frameIndex = frameIndex;
+	mCurrent = &slot;
+	mDepth = 0;
+	mFrameZone = BeginZone("Frame");
+}
+
+//-----------------------------------------------------------------------------
+void GpuProfiler::EndFrame()
+{
+	if (mCurrent == nullptr) {
+		return;
+	}
+
+	EndZone(mFrameZone);
+	mFrameZone = -1;
+	mCurrent->pending = (mCurrent->queryCount > 0);
+	mCurrent = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+int GpuProfiler::BeginZone(const char* name)
+{
+	// 열려 있는 구간들이 닫힐 때 쓸 쿼리까지 남겨둬야 한다.
+	if (mCurrent == nullptr || mCurrent->queryCount + mDepth + 2 > MAX_ZONES_PER_FRAME * 2) {
+		return -1;
+	}
+
+	ZoneRecord zone{};
+	zone.name = name;
+	zone.depth = mDepth;
+	zone.beginQuery = IssueTimestamp();
+	mCurrent->zones.push_back(zone);
+	++mDepth;
+	return static_cast<int>(mCurrent->zones.size()) - 1;
+}
+
+//-----------------------------------------------------------------------------
+void GpuProfiler::EndZone(int zone)
+{
+	if (mCurrent == nullptr || zone < 0) {
+		return;
+	}
+
+	--mDepth;
+	mCurrent->zones[zone].endQuery = IssueTimestamp();
+}
+
+//-----------------------------------------------------------------------------
+int GpuProfiler::IssueTimestamp()
+{
+	int index = mCurrent->queryCount++;
+	glQueryCounter(mCurrent->queries[index], GL_TIMESTAMP);
+	return index;
+}
+
+//-----------------------------------------------------------------------------
+bool GpuProfiler::CollectSlot(FrameSlot& slot)
+{
+	// 타임스탬프는 순서대로 끝나므로 마지막 쿼리만 확인하면 된다.
+	GLint available = 0;
+	glGetQueryObjectiv(slot.queries[slot.queryCount - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+	if (!available) {
+		return false;
+	}
+
+	GLuint64 timestamps[MAX_ZONES_PER_FRAME * 2]{};
+	for (int i = 0; i < slot.queryCount; ++i) {
+		glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &timestamps[i]);
+	}
+
+	mLastResults.clear();
+	mLastFrameMilliseconds = 0.0;
+	for (const ZoneRecord& zone : slot.zones) {
+		if (zone.endQuery < 0) {
+			continue;
+		}
+		double milliseconds = static_cast<double>(timestamps[zone.endQuery] - timestamps[zone.beginQuery]) / 1000000.0;
+		mLastResults.push_back(ZoneResult{ zone.name, zone.depth, milliseconds });
+		if (zone.depth == 0) {
+			mLastFrameMilliseconds += milliseconds;
+		}
+	}
+	slot.pending = false;
+
+	if (mResultCallback) {
+		mResultCallback(slot.frameIndex, mLastResults, mLastFrameMilliseconds);
+	}
+	return true;
+}
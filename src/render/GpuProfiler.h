@@ -0,0 +1,106 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// GPU 타이머 쿼리(glQueryCounter + GL_TIMESTAMP) 기반 구간 프로파일러.
+// 쿼리 풀을 프레임 수(FRAME_LATENCY)만큼 돌려 쓰기 때문에, 결과는 몇 프레임 늦게 나오지만
+// 결과를 읽으려고 GPU 를 기다리는 일(파이프라인 stall)은 없다.
+// GL_TIME_ELAPSED 쿼리는 중첩할 수 없어서 구간의 시작/끝을 각각 타임스탬프로 찍는다.
+class GpuProfiler
+{
+public:
+	static constexpr int FRAME_LATENCY = 3;
+	static constexpr int MAX_ZONES_PER_FRAME = 64;
+
+	// 결과가 나온 구간 하나.
+	struct ZoneResult
+	{
+		const char* name{};
+		int depth{};
+		double milliseconds{};
+	};
+
+	// 프레임 하나의 결과가 준비되면 호출된다. (frameIndex, 구간 목록, 프레임 전체 GPU 시간)
+	using ResultCallback = std::function<void(std::int64_t, const std::vector<ZoneResult>&, double)>;
+
+	GpuProfiler();
+	~GpuProfiler();
+
+	// GL 컨텍스트가 만들어진 뒤에 호출한다.
+	void Initialize();
+	// GL 컨텍스트가 없어지기 전에 호출한다.
+	void Shutdown();
+
+	void SetResultCallback(ResultCallback callback);
+
+	// 프레임 시작/끝. BeginFrame 에서 이전 프레임들 중 결과가 준비된 것을 읽어간다.
+	void BeginFrame(std::int64_t frameIndex);
+	void EndFrame();
+
+	// 구간 시작/끝. name 은 문자열 리터럴처럼 오래 살아있는 문자열이어야 한다.
+	int BeginZone(const char* name);
+	void EndZone(int zone);
+
+	// 가장 최근에 결과가 나온 프레임의 구간들.
+	const std::vector<ZoneResult>& GetLastResults() const { return mLastResults; }
+	double GetLastFrameMilliseconds() const { return mLastFrameMilliseconds; }
+
+private:
+	struct ZoneRecord
+	{
+		const char* name{};
+		int depth{};
+		int beginQuery{};
+		int endQuery{ -1 };
+	};
+
+	struct FrameSlot
+	{
+		unsigned int queries[MAX_ZONES_PER_FRAME * 2]{};
+		std::vector<ZoneRecord> zones{};
+		int queryCount{};
+		std::int64_t frameIndex{};
+		bool pending{};
+	};
+
+	// 결과가 준비됐으면 읽어서 콜백으로 넘긴다. 준비 안 됐으면 기다리지 않고 false.
+	bool CollectSlot(FrameSlot& slot);
+	int IssueTimestamp();
+
+private:
+	bool mInitialized{};
+	FrameSlot mSlots[FRAME_LATENCY]{};
+	FrameSlot* mCurrent{};
+	int mFrameZone{ -1 };
+	int mDepth{};
+
+	ResultCallback mResultCallback{};
+	std::vector<ZoneResult> mLastResults{};
+	double mLastFrameMilliseconds{};
+};
+
+// 생성부터 소멸까지를 GPU 구간으로 기록하는 RAII 객체.
+class GpuProfileScope
+{
+public:
+	GpuProfileScope(GpuProfiler& profiler, const char* name)
+		: mProfiler(profiler), mZone(profiler.BeginZone(name))
+	{
+	}
+
+	~GpuProfileScope() {
+		mProfiler.EndZone(mZone);
+	}
+
+	GpuProfileScope(const GpuProfileScope&) = delete;
+	GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+	GpuProfiler& mProfiler;
+	int mZone{};
+};
+
+#define GPU_PROFILE_CONCAT_INNER(a, b) a##b
+#define GPU_PROFILE_CONCAT(a, b) GPU_PROFILE_CONCAT_INNER(a, b)
+#define GPU_PROFILE_SCOPE(profiler, name) GpuProfileScope GPU_PROFILE_CONCAT(gpuProfileScope_, __LINE__)(profiler, name)
@@ -0,0 +1,219 @@
+#include "render/MeshArena.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "glad/glad.h"
+
+#include "mesh/MeshIndices.h"
+#include "render/GlState.h"
+#include "render/VertexArrayCache.h"
+
+//-----------------------------------------------------------------------------
+MeshArena::MeshArena()
+{
+}
+
+//-----------------------------------------------------------------------------
+MeshArena::~MeshArena()
+{
+}
+
+//-----------------------------------------------------------------------------
+void MeshArena::Initialize(VertexArrayCache* vertexArrays, std::uint32_t initialVertexCount, std::uint32_t initialIndexCount)
+{
+	mVertexArrays = vertexArrays;
+	mInitialVertexCount = std::max(initialVertexCount, 1u);
+	mInitialIndexCount = std::max(initialIndexCount, 1u);
+}
+
+//-----------------------------------------------------------------------------
+void MeshArena::Clear()
+{
+	for (Pool& pool : mPools) {
+		mVertexArrays->DeleteBuffer(pool.vertexBuffer);
+		for (unsigned int& indexBuffer : pool.indexBuffers) {
+			mVertexArrays->DeleteBuffer(indexBuffer);
+		}
+	}
+	mPools.clear();
+}
+
+//-----------------------------------------------------------------------------
+unsigned int MeshArena::CreateBuffer(std::size_t size)
+{
+	unsigned int buffer{};
+	if (GLAD_GL_VERSION_4_5) {
+		glCreateBuffers(1, &buffer);
+		glNamedBufferStorage(buffer, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_STORAGE_BIT);
+	}
+	else {
+		glGenBuffers(1, &buffer);
+		GlState::BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STATIC_DRAW);
+	}
+	return buffer;
+}
+
+//-----------------------------------------------------------------------------
+void MeshArena::Upload(unsigned int buffer, std::size_t offset, const void* data, std::size_t size)
+{
+	if (GLAD_GL_VERSION_4_5) {
+		glNamedBufferSubData(buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+	}
+	else {
+		// GL_COPY_WRITE_BUFFER 는 그리기와 상관없는 바인딩이라 VAO 상태를 건드리지 않는다.
+		GlState::BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+	}
+}
+
+//-----------------------------------------------------------------------------
+void MeshArena::GrowBuffer(unsigned int& buffer, RangeAllocator& allocator, std::uint32_t elementSize, std::uint32_t elementCount)
+{
+	std::size_t oldSize = static_cast<std::size_t>(allocator.GetCapacity()) * elementSize;
+	unsigned int grown = CreateBuffer(static_cast<std::size_t>(elementCount) * elementSize);
+	if (GLAD_GL_VERSION_4_5) {
+		glCopyNamedBufferSubData(buffer, grown, 0, 0, static_cast<GLsizeiptr>(oldSize));
+	}
+	else {
+		GlState::BindBuffer(GL_COPY_READ_BUFFER, buffer);
+		GlState::BindBuffer(GL_COPY_WRITE_BUFFER, grown);
+		glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, static_cast<GLsizeiptr>(oldSize));
+	}
+	// VAO 에 붙어 있던 이전 버퍼는 떼어 낸다. 다음 Bind 에서 새 버퍼가 붙는다.
+	mVertexArrays->DeleteBuffer(buffer);
+	buffer = grown;
+	allocator.Grow(elementCount);
+	++mGrowCount;
+}
+
+//-----------------------------------------------------------------------------
+int MeshArena::GetOrCreatePool(const VertexFormat& format, std::uint32_t vertexCount)
+{
+	for (std::size_t i = 0; i < mPools.size(); ++i) {
+		if (mPools[i].format == format) {
+			return static_cast<int>(i);
+		}
+	}
+
+	Pool pool{};
+	pool.format = format;
+	std::uint32_t vertexCapacity = std::max(mInitialVertexCount, vertexCount);
+	pool.vertexBuffer = CreateBuffer(static_cast<std::size_t>(vertexCapacity) * format.stride);
+	pool.vertices.Reset(vertexCapacity);
+	mPools.push_back(pool);
+	return static_cast<int>(mPools.size() - 1);
+}
+
+//-----------------------------------------------------------------------------
+MeshArena::MeshHandle MeshArena::Allocate(const VertexFormat& format, const void* vertices, std::uint32_t vertexCount,
+	const unsigned int* indices, std::uint32_t indexCount)
+{
+	MeshHandle mesh{};
+	if (mVertexArrays == nullptr || vertexCount == 0 || indexCount == 0) {
+		return mesh;
+	}
+
+	int poolIndex = GetOrCreatePool(format, vertexCount);
+	Pool& pool = mPools[poolIndex];
+	std::uint32_t indexSize = MeshIndices::ChooseIndexSize(vertexCount);
+	int slot = GetIndexSlot(indexSize);
+	unsigned int& indexBuffer = pool.indexBuffers[slot];
+	RangeAllocator& indexAllocator = pool.indices[slot];
+	if (indexBuffer == 0) {
+		std::uint32_t indexCapacity = std::max(mInitialIndexCount, indexCount);
+		indexBuffer = CreateBuffer(static_cast<std::size_t>(indexCapacity) * indexSize);
+		indexAllocator.Reset(indexCapacity);
+	}
+
+	std::uint32_t baseVertex = pool.vertices.Allocate(vertexCount);
+	if (baseVertex == RangeAllocator::INVALID_OFFSET) {
+		GrowBuffer(pool.vertexBuffer, pool.vertices, format.stride, std::max(pool.vertices.GetCapacity() * 2, pool.vertices.GetCapacity() + vertexCount));
+		baseVertex = pool.vertices.Allocate(vertexCount);
+	}
+	std::uint32_t firstIndex = indexAllocator.Allocate(indexCount);
+	if (firstIndex == RangeAllocator::INVALID_OFFSET) {
+		GrowBuffer(indexBuffer, indexAllocator, indexSize, std::max(indexAllocator.GetCapacity() * 2, indexAllocator.GetCapacity() + indexCount));
+		firstIndex = indexAllocator.Allocate(indexCount);
+	}
+	if (baseVertex == RangeAllocator::INVALID_OFFSET || firstIndex == RangeAllocator::INVALID_OFFSET) {
+		std::cout << "[MeshArena] failed to allocate " << vertexCount << " vertices, " << indexCount << " indices" << std::endl;
+		pool.vertices.Free(baseVertex);
+		indexAllocator.Free(firstIndex);
+		return mesh;
+	}
+
+	std::vector<std::uint8_t> packedIndices{};
+	MeshIndices::Pack(indices, indexCount, indexSize, packedIndices);
+	Upload(pool.vertexBuffer, static_cast<std::size_t>(baseVertex) * format.stride, vertices, static_cast<std::size_t>(vertexCount) * format.stride);
+	Upload(indexBuffer, static_cast<std::size_t>(firstIndex) * indexSize, packedIndices.data(), packedIndices.size());
+
+	mesh.pool = poolIndex;
+	mesh.baseVertex = baseVertex;
+	mesh.vertexCount = vertexCount;
+	mesh.firstIndex = firstIndex;
+	mesh.indexCount = indexCount;
+	mesh.indexSize = indexSize;
+	return mesh;
+}
+
+//-----------------------------------------------------------------------------
+void MeshArena::Free(MeshHandle& mesh)
+{
+	if (!mesh.IsValid() || mesh.pool >= static_cast<int>(mPools.size())) {
+		mesh = MeshHandle{};
+		return;
+	}
+	Pool& pool = mPools[mesh.pool];
+	pool.vertices.Free(mesh.baseVertex);
+	pool.indices[GetIndexSlot(mesh.indexSize)].Free(mesh.firstIndex);
+	mesh = MeshHandle{};
+}
+
+//-----------------------------------------------------------------------------
+void MeshArena::Bind(const MeshHandle& mesh)
+{
+	const Pool& pool = mPools[mesh.pool];
+	mVertexArrays->Bind(pool.format, pool.vertexBuffer, pool.indexBuffers[GetIndexSlot(mesh.indexSize)]);
+}
+
+//-----------------------------------------------------------------------------
+void MeshArena::Draw(const MeshHandle& mesh)
+{
+	Draw(mesh, 0, mesh.indexCount);
+}
+
+//-----------------------------------------------------------------------------
+void MeshArena::Draw(const MeshHandle& mesh, std::uint32_t indexOffset, std::uint32_t indexCount)
+{
+	if (!mesh.IsValid()) {
+		return;
+	}
+	Bind(mesh);
+	std::size_t firstIndex = static_cast<std::size_t>(mesh.firstIndex) + indexOffset;
+	glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(indexCount), MeshIndices::GetIndexType(mesh.indexSize),
+		reinterpret_cast<const void*>(firstIndex * mesh.indexSize), static_cast<GLint>(mesh.baseVertex));
+}
+
+//-----------------------------------------------------------------------------
+std::uint64_t MeshArena::GetCapacityBytes() const
+{
+	std::uint64_t bytes{};
+	for (const Pool& pool : mPools) {
+		bytes += static_cast<std::uint64_t>(pool.vertices.GetCapacity()) * pool.format.stride;
+		bytes += static_cast<std::uint64_t>(pool.indices[0].GetCapacity()) * 2 + static_cast<std::uint64_t>(pool.indices[1].GetCapacity()) * 4;
+	}
+	return bytes;
+}
+
+//-----------------------------------------------------------------------------
+std::uint64_t MeshArena::GetUsedBytes() const
+{
+	std::uint64_t bytes{};
+	for (const Pool& pool : mPools) {
+		bytes += static_cast<std::uint64_t>(pool.vertices.GetUsedSize()) * pool.format.stride;
+		bytes += static_cast<std::uint64_t>(pool.indices[0].GetUsedSize()) * 2 + static_cast<std::uint64_t>(pool.indices[1].GetUsedSize()) * 4;
+	}
+	return bytes;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "common/VertexLayout.h"
+#include "core/RangeAllocator.h"
+
+class VertexArrayCache;
+
+// 버텍스 포맷마다 큰 버텍스 버퍼와 인덱스 버퍼를 하나씩 만들어 두고 메시마다 구간을 잘라 주는 아레나.
+// 같은 포맷의 메시는 모두 같은 버퍼를 쓰므로 메시를 바꿔 그려도 VAO/버퍼를 다시 붙이지 않는다.
+// 인덱스는 메시 안의 번호 그대로 올리고 glDrawElementsBaseVertex 로 버텍스 시작 위치를 더한다.
+// 그래서 메시마다 버텍스가 65536 개 이하이면 16비트 인덱스로 올린다. (인덱스 폭마다 인덱스 버퍼가 따로 있다)
+// 자리가 모자라면 버퍼를 두 배로 키워서 기존 내용을 GPU 안에서 복사한다. (MeshHandle 은 그대로 유효하다)
+class MeshArena
+{
+public:
+	// 아레나 안에 올린 메시 하나. 단위는 버텍스/인덱스 개수.
+	struct MeshHandle
+	{
+		int pool{ -1 };
+		std::uint32_t baseVertex{};
+		std::uint32_t vertexCount{};
+		std::uint32_t firstIndex{};
+		std::uint32_t indexCount{};
+		// 인덱스 하나의 바이트 수. (2 또는 4)
+		std::uint32_t indexSize{ 4 };
+
+		bool IsValid() const { return pool >= 0; }
+	};
+
+	MeshArena();
+	~MeshArena();
+
+	MeshArena(const MeshArena&) = delete;
+	MeshArena& operator=(const MeshArena&) = delete;
+
+	// 포맷별 버퍼는 처음 Allocate 할 때 (최소) 이 크기로 만든다.
+	void Initialize(VertexArrayCache* vertexArrays, std::uint32_t initialVertexCount, std::uint32_t initialIndexCount);
+	// GL 컨텍스트가 없어지기 전에 호출한다. 모든 핸들이 무효가 된다.
+	void Clear();
+
+	// 인덱스는 unsigned int 로 받아서 버텍스 수에 맞는 폭으로 바꿔 올린다.
+	MeshHandle Allocate(const VertexFormat& format, const void* vertices, std::uint32_t vertexCount,
+		const unsigned int* indices, std::uint32_t indexCount);
+	template <typename T>
+	MeshHandle Allocate(const std::vector<T>& vertices, const std::vector<unsigned int>& indices)
+	{
+		return Allocate(VertexLayout<T>::GetFormat(), vertices.data(), static_cast<std::uint32_t>(vertices.size()),
+			indices.data(), static_cast<std::uint32_t>(indices.size()));
+	}
+	void Free(MeshHandle& mesh);
+
+	// 메시가 든 버퍼를 포맷의 VAO 에 붙인다. 같은 포맷끼리는 한 번만 붙는다.
+	void Bind(const MeshHandle& mesh);
+	// 메시 전체, 또는 메시 안의 인덱스 구간(서브메시)을 그린다. (GL_TRIANGLES)
+	void Draw(const MeshHandle& mesh);
+	void Draw(const MeshHandle& mesh, std::uint32_t indexOffset, std::uint32_t indexCount);
+
+	int GetPoolCount() const { return static_cast<int>(mPools.size()); }
+	std::uint64_t GetGrowCount() const { return mGrowCount; }
+	// 모든 포맷의 버퍼 크기와 실제로 쓰는 크기. (바이트)
+	std::uint64_t GetCapacityBytes() const;
+	std::uint64_t GetUsedBytes() const;
+
+private:
+	// 인덱스 폭별 버퍼 자리. 0: 16비트, 1: 32비트.
+	static constexpr int INDEX_WIDTH_COUNT = 2;
+	static int GetIndexSlot(std::uint32_t indexSize) { return (indexSize == 2) ? 0 : 1; }
+
+	struct Pool
+	{
+		VertexFormat format{};
+		unsigned int vertexBuffer{};
+		RangeAllocator vertices{};
+		// 인덱스 버퍼는 그 폭의 메시가 처음 들어올 때 만든다.
+		unsigned int indexBuffers[INDEX_WIDTH_COUNT]{};
+		RangeAllocator indices[INDEX_WIDTH_COUNT]{};
+	};
+
+	int GetOrCreatePool(const VertexFormat& format, std::uint32_t vertexCount);
+	// 버퍼를 elementCount 개까지 키운다. 기존 내용은 복사하고 이전 버퍼는 지운다.
+	void GrowBuffer(unsigned int& buffer, RangeAllocator& allocator, std::uint32_t elementSize, std::uint32_t elementCount);
+
+	static unsigned int CreateBuffer(std::size_t size);
+	static void Upload(unsigned int buffer, std::size_t offset, const void* data, std::size_t size);
+
+private:
+	VertexArrayCache* mVertexArrays{};
+	std::uint32_t mInitialVertexCount{ 65536 };
+	std::uint32_t mInitialIndexCount{ 196608 };
+	std::vector<Pool> mPools{};
+	std::uint64_t mGrowCount{};
+};
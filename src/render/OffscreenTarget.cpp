@@ -0,0 +1,83 @@
+#include "render/OffscreenTarget.h"
+
+#include <iostream>
+
+#include "glad/glad.h"
+
+//-----------------------------------------------------------------------------
+OffscreenTarget::OffscreenTarget()
+{
+}
+
+//-----------------------------------------------------------------------------
+OffscreenTarget::~OffscreenTarget()
+{
+	// GL 자원은 컨텍스트가 살아 있을 때 Destroy() 로 지워야 한다.
+}
+
+//-----------------------------------------------------------------------------
+bool OffscreenTarget::Create(int width, int height)
+{
+	Destroy();
+	mWidth = width;
+	mHeight = height;
+
+	glGenTextures(1, &mColorTexture);
+	glBindTexture(GL_TEXTURE_2D, mColorTexture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenRenderbuffers(1, &mDepthStencil);
+	glBindRenderbuffer(GL_RENDERBUFFER, mDepthStencil);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glGenFramebuffers(1, &mFramebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mColorTexture, 0);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, mDepthStencil);
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		std::cerr << "[OffscreenTarget] framebuffer incomplete: 0x" << std::hex << status << std::dec << std::endl;
+		Destroy();
+		return false;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void OffscreenTarget::Destroy()
+{
+	if (mFramebuffer != 0) {
+		glDeleteFramebuffers(1, &mFramebuffer);
+		mFramebuffer = 0;
+	}
+	if (mDepthStencil != 0) {
+		glDeleteRenderbuffers(1, &mDepthStencil);
+		mDepthStencil = 0;
+	}
+	if (mColorTexture != 0) {
+		glDeleteTextures(1, &mColorTexture);
+		mColorTexture = 0;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void OffscreenTarget::Bind() const
+{
+	glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+	glViewport(0, 0, mWidth, mHeight);
+}
+
+//-----------------------------------------------------------------------------
+void OffscreenTarget::BlitToDefault(int width, int height) const
+{
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, mFramebuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+	glBlitFramebuffer(0, 0, mWidth, mHeight, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+// 색상 텍스처(RGBA8) + 깊이/스텐실 렌더버퍼를 가진 프레임버퍼.
+// 창 크기와 상관없이 고정된 크기로 렌더링할 때 쓴다. (골든 이미지 비교, 헤드리스 실행)
+class OffscreenTarget
+{
+public:
+	OffscreenTarget();
+	~OffscreenTarget();
+
+	OffscreenTarget(const OffscreenTarget&) = delete;
+	OffscreenTarget& operator=(const OffscreenTarget&) = delete;
+
+	// GL 컨텍스트를 가진 스레드에서 호출한다.
+	bool Create(int width, int height);
+	void Destroy();
+
+	// 그리기 대상으로 바인딩하고 뷰포트를 전체 크기로 맞춘다.
+	void Bind() const;
+	// 기본 프레임버퍼로 복사한다. 창에도 같은 화면이 보이게 할 때 쓴다.
+	void BlitToDefault(int width, int height) const;
+
+	bool IsValid() const { return mFramebuffer != 0; }
+	unsigned int GetFramebuffer() const { return mFramebuffer; }
+	unsigned int GetColorTexture() const { return mColorTexture; }
+	int GetWidth() const { return mWidth; }
+	int GetHeight() const { return mHeight; }
+
+private:
+	unsigned int mFramebuffer{};
+	unsigned int mColorTexture{};
+	unsigned int mDepthStencil{};
+	int mWidth{};
+	int mHeight{};
+};
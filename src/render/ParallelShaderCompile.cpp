@@ -0,0 +1,65 @@
+#include "render/ParallelShaderCompile.h"
+
+#include "glad/glad.h"
+#include "GLFW/glfw3.h"
+
+namespace {
+
+// GL_KHR_parallel_shader_compile / GL_ARB_parallel_shader_compile 의 값. (둘이 같다)
+constexpr GLenum GL_COMPLETION_STATUS = 0x91B1;
+
+using MaxShaderCompilerThreadsProc = void (APIENTRYP)(GLuint count);
+
+bool gSupported = false;
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+bool ParallelShaderCompile::Initialize(unsigned int threadCount)
+{
+	gSupported = false;
+
+	MaxShaderCompilerThreadsProc maxThreads = nullptr;
+	if (glfwExtensionSupported("GL_KHR_parallel_shader_compile")) {
+		maxThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(glfwGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+	}
+	else if (glfwExtensionSupported("GL_ARB_parallel_shader_compile")) {
+		maxThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(glfwGetProcAddress("glMaxShaderCompilerThreadsARB"));
+	}
+	if (maxThreads == nullptr) {
+		return false;
+	}
+
+	// 0xFFFFFFFF 는 "구현이 정한 최대 스레드 수" 를 뜻한다.
+	maxThreads(threadCount == 0 ? 0xFFFFFFFFu : threadCount);
+	gSupported = true;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool ParallelShaderCompile::IsSupported()
+{
+	return gSupported;
+}
+
+//-----------------------------------------------------------------------------
+bool ParallelShaderCompile::IsShaderComplete(unsigned int shader)
+{
+	if (!gSupported) {
+		return true;
+	}
+	GLint complete = GL_FALSE;
+	glGetShaderiv(shader, GL_COMPLETION_STATUS, &complete);
+	return complete == GL_TRUE;
+}
+
+//-----------------------------------------------------------------------------
+bool ParallelShaderCompile::IsProgramComplete(unsigned int program)
+{
+	if (!gSupported) {
+		return true;
+	}
+	GLint complete = GL_FALSE;
+	glGetProgramiv(program, GL_COMPLETION_STATUS, &complete);
+	return complete == GL_TRUE;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+// GL_KHR_parallel_shader_compile (또는 ARB) 지원.
+// glad 에 이 확장이 없어서 함수 포인터는 직접 읽어 온다.
+// 지원하면 드라이버가 컴파일/링크를 자체 스레드에서 하고, GL_COMPLETION_STATUS 로 끝났는지
+// 기다리지 않고 물어볼 수 있다. 지원하지 않으면 완료 확인은 항상 true 이고 상태 조회가 블록된다.
+namespace ParallelShaderCompile
+{
+	// GL 컨텍스트가 만들어진 뒤에 호출한다. threadCount 가 0 이면 드라이버가 정한 최대값.
+	bool Initialize(unsigned int threadCount = 0);
+	bool IsSupported();
+
+	// 기다리지 않고 컴파일/링크가 끝났는지 확인한다.
+	bool IsShaderComplete(unsigned int shader);
+	bool IsProgramComplete(unsigned int program);
+}
@@ -0,0 +1,166 @@
+#include "render/PixelReadback.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "glad/glad.h"
+
+//-----------------------------------------------------------------------------
+PixelReadback::PixelReadback()
+{
+}
+
+//-----------------------------------------------------------------------------
+PixelReadback::~PixelReadback()
+{
+}
+
+//-----------------------------------------------------------------------------
+void PixelReadback::Initialize(int width, int height)
+{
+	Shutdown();
+	mWidth = width;
+	mHeight = height;
+
+	GLsizeiptr size = static_cast<GLsizeiptr>(width) * height * 4;
+	for (Slot& slot : mSlots) {
+		glGenBuffers(1, &slot.buffer);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+		glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+		slot.pending = false;
+		slot.fence = nullptr;
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	mDroppedCount = 0;
+	mInitialized = true;
+}
+
+//-----------------------------------------------------------------------------
+void PixelReadback::Shutdown()
+{
+	if (!mInitialized) {
+		return;
+	}
+
+	for (Slot& slot : mSlots) {
+		if (slot.fence != nullptr) {
+			glDeleteSync(static_cast<GLsync>(slot.fence));
+			slot.fence = nullptr;
+		}
+		glDeleteBuffers(1, &slot.buffer);
+		slot.buffer = 0;
+		slot.pending = false;
+	}
+	mInitialized = false;
+}
+
+//-----------------------------------------------------------------------------
+void PixelReadback::SetCallback(Callback callback)
+{
+	mCallback = std::move(callback);
+}
+
+//-----------------------------------------------------------------------------
+bool PixelReadback::Request(std::int64_t tag)
+{
+	if (!mInitialized) {
+		return false;
+	}
+
+	Slot* freeSlot = nullptr;
+	for (Slot& slot : mSlots) {
+		if (!slot.pending) {
+			freeSlot = &slot;
+			break;
+		}
+	}
+	if (freeSlot == nullptr) {
+		// 링이 꽉 찼다. 기다리면 stall 이 생기므로 이번 요청은 버린다.
+		++mDroppedCount;
+		return false;
+	}
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, freeSlot->buffer);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	// PBO 가 바인딩되어 있으면 마지막 인자는 버퍼 안의 오프셋이다.
+	glReadPixels(0, 0, mWidth, mHeight, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	freeSlot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	freeSlot->tag = tag;
+	freeSlot->sequence = mNextSequence++;
+	freeSlot->pending = true;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void PixelReadback::Collect(bool wait)
+{
+	if (!mInitialized) {
+		return;
+	}
+
+	Slot* pendingSlots[RING_SIZE]{};
+	int pendingCount = 0;
+	for (Slot& slot : mSlots) {
+		if (slot.pending) {
+			pendingSlots[pendingCount++] = &slot;
+		}
+	}
+	std::sort(pendingSlots, pendingSlots + pendingCount, [](const Slot* a, const Slot* b) {
+		return a->sequence < b->sequence;
+	});
+
+	// 앞의 읽기가 안 끝났으면 뒤의 것도 안 끝났으므로 거기서 멈춘다.
+	for (int i = 0; i < pendingCount; ++i) {
+		if (!CollectSlot(*pendingSlots[i], wait)) {
+			break;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool PixelReadback::CollectSlot(Slot& slot, bool wait)
+{
+	GLsync fence = static_cast<GLsync>(slot.fence);
+	// 기다리지 않을 때는 timeout 0 으로 상태만 확인한다.
+	GLbitfield flags = wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0;
+	GLuint64 timeout = wait ? 1000000000ull : 0;
+	GLenum result = glClientWaitSync(fence, flags, timeout);
+	if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+		return false;
+	}
+	glDeleteSync(fence);
+	slot.fence = nullptr;
+	slot.pending = false;
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+	std::size_t rowBytes = static_cast<std::size_t>(mWidth) * 4;
+	const std::uint8_t* data = static_cast<const std::uint8_t*>(
+		glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, rowBytes * mHeight, GL_MAP_READ_BIT));
+	if (data != nullptr) {
+		// GL 은 아래 행부터 읽으므로 뒤집어서 첫 행이 맨 위가 되게 한다.
+		mImage.Resize(mWidth, mHeight);
+		for (int y = 0; y < mHeight; ++y) {
+			std::memcpy(mImage.GetRow(mHeight - 1 - y), data + rowBytes * y, rowBytes);
+		}
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	if (data != nullptr && mCallback) {
+		mCallback(slot.tag, mImage);
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool PixelReadback::HasPending() const
+{
+	for (const Slot& slot : mSlots) {
+		if (slot.pending) {
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+
+#include "common/Image.h"
+
+// 픽셀 팩 버퍼(PBO) 링을 이용한 비동기 화면 읽기.
+// glReadPixels 를 PBO 로 받게 하면 호출 즉시 돌아오고, 복사는 GPU 가 나중에 한다.
+// 펜스가 신호된 뒤에만 맵핑해서 읽으므로 렌더링 파이프라인을 멈추지 않는다.
+class PixelReadback
+{
+public:
+	static constexpr int RING_SIZE = 3;
+
+	// 읽기가 끝난 이미지를 받는다. (요청할 때 넘긴 tag, 이미지)
+	using Callback = std::function<void(std::int64_t, const Image&)>;
+
+	PixelReadback();
+	~PixelReadback();
+
+	// GL 컨텍스트를 가진 스레드에서 호출한다.
+	void Initialize(int width, int height);
+	void Shutdown();
+
+	void SetCallback(Callback callback);
+
+	// 현재 GL_READ_FRAMEBUFFER 의 내용을 비동기로 읽기 시작한다.
+	// 빈 슬롯이 없으면(앞선 읽기가 아직 안 끝났으면) 기다리지 않고 false.
+	bool Request(std::int64_t tag);
+	// 끝난 읽기를 오래된 순서대로 콜백으로 넘긴다. wait 이면 남은 읽기를 모두 기다린다.
+	void Collect(bool wait = false);
+
+	bool HasPending() const;
+	int GetDroppedCount() const { return mDroppedCount; }
+
+private:
+	struct Slot
+	{
+		unsigned int buffer{};
+		void* fence{};
+		std::int64_t tag{};
+		std::int64_t sequence{};
+		bool pending{};
+	};
+
+	bool CollectSlot(Slot& slot, bool wait);
+
+private:
+	bool mInitialized{};
+	int mWidth{};
+	int mHeight{};
+	Slot mSlots[RING_SIZE]{};
+	std::int64_t mNextSequence{};
+	int mDroppedCount{};
+	Image mImage{};
+	Callback mCallback{};
+};
@@ -0,0 +1,184 @@
+#include "render/ProgramBinaryCache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include "glad/glad.h"
+
+#include "core/Hash.h"
+#include "core/Profiler.h"
+#include "render/ShaderProgram.h"
+
+namespace {
+
+// 파일 형식이 바뀌면 FILE_VERSION 을 올린다. 이전 파일은 자동으로 무시된다.
+constexpr std::uint32_t FILE_MAGIC = 0x42504C47;	// "GLPB"
+constexpr std::uint32_t FILE_VERSION = 1;
+
+struct BinaryFileHeader
+{
+	std::uint32_t magic{};
+	std::uint32_t version{};
+	std::uint64_t driverHash{};
+	std::uint64_t sourceKey{};
+	std::uint32_t format{};
+	std::uint32_t length{};
+};
+
+//-----------------------------------------------------------------------------
+std::string GetGlString(GLenum name)
+{
+	const GLubyte* value = glGetString(name);
+	return (value != nullptr) ? reinterpret_cast<const char*>(value) : "";
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+ProgramBinaryCache::ProgramBinaryCache()
+{
+}
+
+//-----------------------------------------------------------------------------
+ProgramBinaryCache::~ProgramBinaryCache()
+{
+}
+
+//-----------------------------------------------------------------------------
+bool ProgramBinaryCache::Initialize(const std::string& directory)
+{
+	mEnabled = false;
+	mDirectory = directory;
+	mLoadCount = 0;
+	mRejectCount = 0;
+
+	GLint formatCount = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+	if (formatCount <= 0) {
+		std::cout << "[ProgramBinaryCache] driver supports no program binary formats, disabled" << std::endl;
+		return false;
+	}
+	mSupportedFormats.assign(formatCount, 0);
+	glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, mSupportedFormats.data());
+
+	// 드라이버가 바뀌면(업데이트 포함) 바이너리를 쓸 수 없으므로 드라이버 정보를 키에 넣는다.
+	std::string driver = GetGlString(GL_VENDOR) + "|" + GetGlString(GL_RENDERER) + "|" + GetGlString(GL_VERSION);
+	mDriverHash = Hash::Fnv1a64(driver);
+
+	std::error_code error{};
+	std::filesystem::create_directories(mDirectory, error);
+	if (error) {
+		std::cout << "[ProgramBinaryCache] failed to create " << mDirectory << ": " << error.message() << std::endl;
+		return false;
+	}
+
+	mEnabled = true;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+std::string ProgramBinaryCache::GetPath(std::uint64_t sourceKey) const
+{
+	char fileName[64]{};
+	std::snprintf(fileName, sizeof(fileName), "%016llx_%016llx.bin",
+		static_cast<unsigned long long>(sourceKey), static_cast<unsigned long long>(mDriverHash));
+	return (std::filesystem::path(mDirectory) / fileName).string();
+}
+
+//-----------------------------------------------------------------------------
+bool ProgramBinaryCache::IsFormatSupported(std::uint32_t format) const
+{
+	return std::find(mSupportedFormats.begin(), mSupportedFormats.end(), static_cast<int>(format)) != mSupportedFormats.end();
+}
+
+//-----------------------------------------------------------------------------
+bool ProgramBinaryCache::Load(std::uint64_t sourceKey, ShaderProgram& program, const std::string& name)
+{
+	if (!mEnabled) {
+		return false;
+	}
+
+	PROFILE_SCOPE("ProgramBinaryCache::Load");
+	std::string path = GetPath(sourceKey);
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		return false;
+	}
+
+	BinaryFileHeader header{};
+	file.read(reinterpret_cast<char*>(&header), sizeof(header));
+	bool valid = file
+		&& header.magic == FILE_MAGIC
+		&& header.version == FILE_VERSION
+		&& header.driverHash == mDriverHash
+		&& header.sourceKey == sourceKey
+		&& IsFormatSupported(header.format)
+		&& header.length > 0;
+
+	std::vector<std::uint8_t> binary{};
+	if (valid) {
+		binary.resize(header.length);
+		file.read(reinterpret_cast<char*>(binary.data()), binary.size());
+		valid = static_cast<bool>(file);
+	}
+	file.close();
+
+	// 드라이버가 바이너리를 거부할 수도 있다. 그러면 파일을 지우고 소스에서 다시 만든다.
+	if (!valid || !program.LoadBinary(header.format, binary.data(), static_cast<int>(binary.size()), name)) {
+		++mRejectCount;
+		std::error_code error{};
+		std::filesystem::remove(path, error);
+		return false;
+	}
+
+	++mLoadCount;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void ProgramBinaryCache::Store(std::uint64_t sourceKey, const ShaderProgram& program)
+{
+	if (!mEnabled || !program.IsValid()) {
+		return;
+	}
+
+	PROFILE_SCOPE("ProgramBinaryCache::Store");
+	unsigned int format = 0;
+	std::vector<std::uint8_t> binary{};
+	if (!program.GetBinary(format, binary)) {
+		return;
+	}
+
+	BinaryFileHeader header{};
+	header.magic = FILE_MAGIC;
+	header.version = FILE_VERSION;
+	header.driverHash = mDriverHash;
+	header.sourceKey = sourceKey;
+	header.format = format;
+	header.length = static_cast<std::uint32_t>(binary.size());
+
+	// 다른 프로세스가 쓰다 만 파일을 읽지 않도록 임시 파일에 쓴 뒤 이름을 바꾼다.
+	std::string path = GetPath(sourceKey);
+	std::string temporaryPath = path + ".tmp";
+	{
+		std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+		if (!file) {
+			std::cout << "[ProgramBinaryCache] failed to open " << temporaryPath << std::endl;
+			return;
+		}
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+		if (!file) {
+			return;
+		}
+	}
+
+	std::error_code error{};
+	std::filesystem::rename(temporaryPath, path, error);
+	if (error) {
+		std::filesystem::remove(temporaryPath, error);
+	}
+}
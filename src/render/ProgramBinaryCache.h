@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ShaderProgram;
+
+// 링크된 프로그램 바이너리(glGetProgramBinary)를 디스크에 저장해 두고 다음 실행 때
+// glProgramBinary 로 바로 읽어서 컴파일/링크를 건너뛴다.
+// 파일은 "<소스 해시>_<드라이버 해시>.bin" 이름으로 저장하고, 헤더에 드라이버(vendor/renderer/version)
+// 해시, 소스 해시, 바이너리 포맷을 같이 기록한다. 드라이버가 바뀌었거나 바이너리를 받아주지 않으면
+// 그 파일은 버리고 소스에서 다시 컴파일한다.
+class ProgramBinaryCache
+{
+public:
+	ProgramBinaryCache();
+	~ProgramBinaryCache();
+
+	// GL 컨텍스트가 만들어진 뒤에 호출한다. 드라이버가 바이너리 포맷을 하나도 지원하지 않으면 꺼진다.
+	bool Initialize(const std::string& directory);
+	bool IsEnabled() const { return mEnabled; }
+
+	// 저장된 바이너리로 프로그램을 만든다. 없거나 맞지 않으면 false.
+	bool Load(std::uint64_t sourceKey, ShaderProgram& program, const std::string& name);
+	// 링크된 프로그램의 바이너리를 저장한다.
+	void Store(std::uint64_t sourceKey, const ShaderProgram& program);
+
+	int GetLoadCount() const { return mLoadCount; }
+	int GetRejectCount() const { return mRejectCount; }
+
+private:
+	std::string GetPath(std::uint64_t sourceKey) const;
+	bool IsFormatSupported(std::uint32_t format) const;
+
+private:
+	bool mEnabled{};
+	std::string mDirectory{};
+	std::uint64_t mDriverHash{};
+	std::vector<int> mSupportedFormats{};
+	int mLoadCount{};
+	int mRejectCount{};
+};
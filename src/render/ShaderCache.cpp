@@ -0,0 +1,238 @@
+#include "render/ShaderCache.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "core/Hash.h"
+#include "core/Profiler.h"
+#include "render/UniformBlocks.h"
+
+// 파일 셰이더 앞에 넣는 공용 uniform block 선언.
+static const std::string UNIFORM_BLOCK_PRELUDE = std::string(PerFrameConstants::GLSL) + PerObjectConstants::GLSL;
+
+//-----------------------------------------------------------------------------
+ShaderCache::ShaderCache()
+{
+}
+
+//-----------------------------------------------------------------------------
+ShaderCache::~ShaderCache()
+{
+}
+
+//-----------------------------------------------------------------------------
+std::uint64_t ShaderCache::ComputeKey(const std::string& vertexSource, const std::string& fragmentSource)
+{
+	// 두 소스 사이에 구분자를 넣어서 ("ab", "c") 와 ("a", "bc") 가 같은 키가 되지 않게 한다.
+	std::uint64_t hash = Hash::Fnv1a64(vertexSource);
+	const char separator = '\0';
+	hash = Hash::Fnv1a64(&separator, 1, hash);
+	return Hash::Fnv1a64(fragmentSource, hash);
+}
+
+//-----------------------------------------------------------------------------
+std::shared_ptr<ShaderProgram> ShaderCache::GetOrCreate(const std::string& vertexSource, const std::string& fragmentSource, const std::string& name)
+{
+	std::uint64_t key = ComputeKey(vertexSource, fragmentSource);
+	auto range = mPrograms.equal_range(key);
+	for (auto it = range.first; it != range.second; ++it) {
+		if (it->second.vertexSource == vertexSource && it->second.fragmentSource == fragmentSource) {
+			++mHitCount;
+			return it->second.program;
+		}
+	}
+
+	++mMissCount;
+	auto program = std::make_shared<ShaderProgram>();
+	if (!mBinaryCache.Load(key, *program, name)) {
+		// 저장된 바이너리가 없거나 맞지 않으면 소스에서 컴파일하고, 다음 실행을 위해 저장해 둔다.
+		PROFILE_SCOPE("ShaderCache::Compile");
+		if (!program->Build(vertexSource, fragmentSource, name, mBinaryCache.IsEnabled())) {
+			return nullptr;
+		}
+		mBinaryCache.Store(key, *program);
+	}
+
+	mPrograms.emplace(key, Entry{ vertexSource, fragmentSource, program });
+	return program;
+}
+
+//-----------------------------------------------------------------------------
+std::shared_ptr<ShaderProgram> ShaderCache::GetOrCreateFromFiles(const std::string& vertexPath, const std::string& fragmentPath, const std::string& name, const std::string& defines)
+{
+	std::string vertexSource{};
+	std::string fragmentSource{};
+	if (!ReadSourceFile(vertexPath, vertexSource) || !ReadSourceFile(fragmentPath, fragmentSource)) {
+		return nullptr;
+	}
+	InjectDefines(vertexSource, defines);
+	InjectDefines(fragmentSource, defines);
+
+	std::shared_ptr<ShaderProgram> program = GetOrCreate(vertexSource, fragmentSource, name);
+	if (program != nullptr) {
+		AddFileBinding(vertexPath, fragmentPath, name, program, defines);
+	}
+	return program;
+}
+
+//-----------------------------------------------------------------------------
+void ShaderCache::InjectDefines(std::string& source, const std::string& defines)
+{
+	if (defines.empty()) {
+		return;
+	}
+	std::string::size_type position = 0;
+	if (source.compare(0, 8, "#version") == 0) {
+		position = source.find('\n');
+		if (position == std::string::npos) {
+			source += '\n';
+			position = source.size();
+		}
+		else {
+			++position;
+		}
+	}
+	source.insert(position, defines);
+}
+
+//-----------------------------------------------------------------------------
+void ShaderCache::AddFileBinding(const std::string& vertexPath, const std::string& fragmentPath, const std::string& name, const std::shared_ptr<ShaderProgram>& program, const std::string& defines)
+{
+	// 파일 감시에서 오는 경로와 비교할 수 있도록 절대 경로로 기억한다.
+	std::error_code error{};
+	std::string absoluteVertex = std::filesystem::absolute(vertexPath, error).lexically_normal().string();
+	std::string absoluteFragment = std::filesystem::absolute(fragmentPath, error).lexically_normal().string();
+	for (const FileBinding& binding : mFileBindings) {
+		if (binding.vertexPath == absoluteVertex && binding.fragmentPath == absoluteFragment && binding.defines == defines) {
+			return;
+		}
+	}
+	mFileBindings.push_back(FileBinding{ absoluteVertex, absoluteFragment, name, defines, program });
+}
+
+//-----------------------------------------------------------------------------
+std::shared_ptr<ShaderProgram> ShaderCache::Find(const std::string& vertexSource, const std::string& fragmentSource) const
+{
+	auto range = mPrograms.equal_range(ComputeKey(vertexSource, fragmentSource));
+	for (auto it = range.first; it != range.second; ++it) {
+		if (it->second.vertexSource == vertexSource && it->second.fragmentSource == fragmentSource) {
+			return it->second.program;
+		}
+	}
+	return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+std::shared_ptr<ShaderProgram> ShaderCache::LoadFromBinary(const std::string& vertexSource, const std::string& fragmentSource, const std::string& name)
+{
+	std::uint64_t key = ComputeKey(vertexSource, fragmentSource);
+	auto program = std::make_shared<ShaderProgram>();
+	if (!mBinaryCache.Load(key, *program, name)) {
+		return nullptr;
+	}
+	++mMissCount;
+	mPrograms.emplace(key, Entry{ vertexSource, fragmentSource, program });
+	return program;
+}
+
+//-----------------------------------------------------------------------------
+std::shared_ptr<ShaderProgram> ShaderCache::Adopt(const std::string& vertexSource, const std::string& fragmentSource, const std::string& name, unsigned int linkedProgram)
+{
+	std::uint64_t key = ComputeKey(vertexSource, fragmentSource);
+	auto program = std::make_shared<ShaderProgram>();
+	program->SetName(name);
+	program->ReplaceProgram(linkedProgram);
+	mBinaryCache.Store(key, *program);
+
+	++mMissCount;
+	mPrograms.emplace(key, Entry{ vertexSource, fragmentSource, program });
+	return program;
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderCache::ReadSourceFile(const std::string& path, std::string& source)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		std::cout << "[error] failed to open shader file: " << path << std::endl;
+		return false;
+	}
+	std::ostringstream stream{};
+	stream << file.rdbuf();
+	source = stream.str();
+
+	// 에디터마다 다르게 저장되는 부분을 정리한다. UTF-8 BOM 은 GLSL 컴파일러가 못 읽고, CRLF 는 캐시 키만 바꾼다.
+	if (source.size() >= 3 && static_cast<unsigned char>(source[0]) == 0xEF
+		&& static_cast<unsigned char>(source[1]) == 0xBB && static_cast<unsigned char>(source[2]) == 0xBF) {
+		source.erase(0, 3);
+	}
+	source.erase(std::remove(source.begin(), source.end(), '\r'), source.end());
+	// 블록 선언은 C++ 구조체와 한 곳(UniformBlocks.h)에서 관리하므로 파일에는 없다.
+	InjectDefines(source, UNIFORM_BLOCK_PRELUDE);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderCache::GetSources(const ShaderProgram* program, std::string& vertexSource, std::string& fragmentSource) const
+{
+	for (const auto& item : mPrograms) {
+		if (item.second.program.get() == program) {
+			vertexSource = item.second.vertexSource;
+			fragmentSource = item.second.fragmentSource;
+			return true;
+		}
+	}
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+void ShaderCache::ReplaceSources(ShaderProgram* program, unsigned int linkedProgram, const std::string& vertexSource, const std::string& fragmentSource)
+{
+	std::shared_ptr<ShaderProgram> shared{};
+	for (auto it = mPrograms.begin(); it != mPrograms.end(); ++it) {
+		if (it->second.program.get() == program) {
+			shared = it->second.program;
+			mPrograms.erase(it);
+			break;
+		}
+	}
+
+	program->ReplaceProgram(linkedProgram);
+	if (shared != nullptr) {
+		std::uint64_t key = ComputeKey(vertexSource, fragmentSource);
+		mPrograms.emplace(key, Entry{ vertexSource, fragmentSource, shared });
+		mBinaryCache.Store(key, *program);
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderCache::EnableBinaryCache(const std::string& directory)
+{
+	return mBinaryCache.Initialize(directory);
+}
+
+//-----------------------------------------------------------------------------
+void ShaderCache::PurgeUnused()
+{
+	for (auto it = mPrograms.begin(); it != mPrograms.end();) {
+		if (it->second.program.use_count() == 1) {
+			it = mPrograms.erase(it);
+		}
+		else {
+			++it;
+		}
+	}
+	mFileBindings.erase(std::remove_if(mFileBindings.begin(), mFileBindings.end(), [](const FileBinding& binding) {
+		return binding.program.expired();
+	}), mFileBindings.end());
+}
+
+//-----------------------------------------------------------------------------
+void ShaderCache::Clear()
+{
+	mPrograms.clear();
+	mFileBindings.clear();
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "render/ProgramBinaryCache.h"
+#include "render/ShaderProgram.h"
+
+// 셰이더 프로그램 캐시.
+// 버텍스/프래그먼트 소스 내용의 해시를 키로 써서, 같은 소스 쌍은 한 번만 컴파일/링크하고
+// 같은 ShaderProgram 을 모든 사용처가 나눠 쓴다. 장면을 다시 읽어도 다시 컴파일하지 않는다.
+// 디스크 바이너리 캐시를 켜면 프로세스를 다시 띄워도 컴파일 대신 저장된 바이너리를 읽는다.
+class ShaderCache
+{
+public:
+	// 파일에서 읽어 만든 프로그램과 그 파일 경로. (핫 리로드가 쓴다)
+	struct FileBinding
+	{
+		std::string vertexPath{};
+		std::string fragmentPath{};
+		std::string name{};
+		// #version 줄 뒤에 넣은 #define 들. (셰이더 변형)
+		std::string defines{};
+		std::weak_ptr<ShaderProgram> program{};
+	};
+
+	ShaderCache();
+	~ShaderCache();
+
+	// 같은 소스로 만든 프로그램이 있으면 그것을, 없으면 새로 만들어서 돌려준다.
+	// 컴파일/링크에 실패하면 nullptr. (실패한 것은 캐시하지 않는다)
+	std::shared_ptr<ShaderProgram> GetOrCreate(const std::string& vertexSource, const std::string& fragmentSource, const std::string& name);
+
+	// 파일에서 소스를 읽어서 GetOrCreate 한다. 파일 경로를 기억해 두어 핫 리로드 대상이 된다.
+	// defines("#define X\n" 줄들)가 있으면 두 소스의 #version 줄 뒤에 넣는다.
+	std::shared_ptr<ShaderProgram> GetOrCreateFromFiles(const std::string& vertexPath, const std::string& fragmentPath, const std::string& name, const std::string& defines = "");
+	// 셰이더 파일을 읽고 #version 줄 뒤에 PerFrame/PerObject 블록 선언(UniformBlocks.h)을 넣는다.
+	static bool ReadSourceFile(const std::string& path, std::string& source);
+	// #version 줄 바로 뒤에 defines 를 넣는다. (#version 은 맨 앞에 있어야 한다)
+	static void InjectDefines(std::string& source, const std::string& defines);
+	// 파일에서 만든 프로그램으로 기억해 둔다. (핫 리로드 대상)
+	void AddFileBinding(const std::string& vertexPath, const std::string& fragmentPath, const std::string& name, const std::shared_ptr<ShaderProgram>& program, const std::string& defines = "");
+
+	// 여러 프로그램을 한꺼번에 컴파일하는 쪽(ShaderLibrary)이 쓰는 단계별 함수들.
+	// 메모리 캐시에서 찾기만 한다.
+	std::shared_ptr<ShaderProgram> Find(const std::string& vertexSource, const std::string& fragmentSource) const;
+	// 디스크 바이너리 캐시에서만 만든다. 없으면 nullptr.
+	std::shared_ptr<ShaderProgram> LoadFromBinary(const std::string& vertexSource, const std::string& fragmentSource, const std::string& name);
+	// 밖에서 링크를 끝낸 프로그램을 캐시에 넣는다.
+	std::shared_ptr<ShaderProgram> Adopt(const std::string& vertexSource, const std::string& fragmentSource, const std::string& name, unsigned int linkedProgram);
+	const std::vector<FileBinding>& GetFileBindings() const { return mFileBindings; }
+
+	// 프로그램이 지금 쓰고 있는 소스.
+	bool GetSources(const ShaderProgram* program, std::string& vertexSource, std::string& fragmentSource) const;
+	// 새 소스로 링크가 끝난 프로그램으로 교체하고, 캐시 키도 새 소스 기준으로 바꾼다.
+	void ReplaceSources(ShaderProgram* program, unsigned int linkedProgram, const std::string& vertexSource, const std::string& fragmentSource);
+
+	// 프로그램 바이너리를 directory 에 저장하고 읽는다. GL 컨텍스트가 만들어진 뒤에 호출한다.
+	bool EnableBinaryCache(const std::string& directory);
+	const ProgramBinaryCache& GetBinaryCache() const { return mBinaryCache; }
+
+	// 캐시만 쥐고 있는(아무도 안 쓰는) 프로그램을 지운다.
+	void PurgeUnused();
+	// 모든 프로그램을 놓는다. GL 컨텍스트가 없어지기 전에 호출한다.
+	void Clear();
+
+	std::size_t GetProgramCount() const { return mPrograms.size(); }
+	int GetHitCount() const { return mHitCount; }
+	int GetMissCount() const { return mMissCount; }
+
+	static std::uint64_t ComputeKey(const std::string& vertexSource, const std::string& fragmentSource);
+
+private:
+	struct Entry
+	{
+		// 해시 충돌을 확인하려고 소스도 같이 보관한다.
+		std::string vertexSource{};
+		std::string fragmentSource{};
+		std::shared_ptr<ShaderProgram> program{};
+	};
+
+	std::unordered_multimap<std::uint64_t, Entry> mPrograms{};
+	std::vector<FileBinding> mFileBindings{};
+	ProgramBinaryCache mBinaryCache{};
+	int mHitCount{};
+	int mMissCount{};
+};
@@ -0,0 +1,108 @@
+#include "render/ShaderFamily.h"
+
+#include <iostream>
+#include <sstream>
+
+#include "core/Profiler.h"
+#include "render/ShaderCache.h"
+#include "render/ShaderProgram.h"
+
+//-----------------------------------------------------------------------------
+std::uint32_t ShaderFeature::Parse(const std::string& list)
+{
+	std::uint32_t features = 0;
+	std::istringstream stream(list);
+	std::string token{};
+	while (std::getline(stream, token, ',')) {
+		if (token.empty()) {
+			continue;
+		}
+		std::string name = (token.compare(0, 4, "USE_") == 0) ? token : "USE_" + token;
+		bool found = false;
+		for (int i = 0; i < FEATURE_COUNT; ++i) {
+			if (name == FEATURE_NAMES[i]) {
+				features |= 1u << i;
+				found = true;
+			}
+		}
+		if (!found) {
+			std::cout << "[warning] unknown shader feature: " << token << std::endl;
+		}
+	}
+	return features;
+}
+
+//-----------------------------------------------------------------------------
+std::string ShaderFeature::ToDefines(std::uint32_t features)
+{
+	std::string defines{};
+	for (int i = 0; i < FEATURE_COUNT; ++i) {
+		if ((features & (1u << i)) != 0) {
+			defines += "#define ";
+			defines += FEATURE_NAMES[i];
+			defines += '\n';
+		}
+	}
+	return defines;
+}
+
+//-----------------------------------------------------------------------------
+ShaderFamily::ShaderFamily()
+{
+}
+
+//-----------------------------------------------------------------------------
+ShaderFamily::~ShaderFamily()
+{
+}
+
+//-----------------------------------------------------------------------------
+void ShaderFamily::Initialize(ShaderCache* cache, const std::string& basePath, const std::string& name)
+{
+	Clear();
+	mCache = cache;
+	mBasePath = basePath;
+	mName = name;
+}
+
+//-----------------------------------------------------------------------------
+std::shared_ptr<ShaderProgram> ShaderFamily::Get(std::uint32_t features)
+{
+	auto found = mVariants.find(features);
+	if (found != mVariants.end()) {
+		return found->second;
+	}
+	if (mCache == nullptr) {
+		return nullptr;
+	}
+
+	PROFILE_SCOPE("ShaderFamily::CompileVariant");
+	std::string variantName = GetVariantName(features);
+	std::shared_ptr<ShaderProgram> program = mCache->GetOrCreateFromFiles(mBasePath + ".vs", mBasePath + ".fs",
+		variantName, ShaderFeature::ToDefines(features));
+	if (program == nullptr) {
+		std::cout << "[error] failed to build shader variant " << variantName << std::endl;
+	}
+	mVariants.emplace(features, program);
+	return program;
+}
+
+//-----------------------------------------------------------------------------
+void ShaderFamily::Clear()
+{
+	mVariants.clear();
+}
+
+//-----------------------------------------------------------------------------
+std::string ShaderFamily::GetVariantName(std::uint32_t features) const
+{
+	// 로그와 프로파일에서 구분되도록 "Rim+USE_TEXTURE" 처럼 붙인다.
+	std::string name = mName;
+	for (int i = 0; i < ShaderFeature::FEATURE_COUNT; ++i) {
+		if ((features & (1u << i)) != 0) {
+			name += '+';
+			name += ShaderFeature::FEATURE_NAMES[i];
+		}
+	}
+	return name;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ShaderCache;
+class ShaderProgram;
+
+// resources/shaders 의 우버셰이더들이 공통으로 쓰는 기능 비트.
+// 비트 i 가 켜지면 소스의 #version 줄 뒤에 "#define FEATURE_NAMES[i]" 가 들어간다.
+namespace ShaderFeature
+{
+	constexpr std::uint32_t TEXTURE = 1u << 0;	// USE_TEXTURE: sample0 텍스처를 곱한다.
+	constexpr std::uint32_t AMBIENT = 1u << 1;	// USE_AMBIENT: ambientIntensity 만큼 환경광을 더한다.
+
+	constexpr const char* FEATURE_NAMES[] = { "USE_TEXTURE", "USE_AMBIENT" };
+	constexpr int FEATURE_COUNT = sizeof(FEATURE_NAMES) / sizeof(FEATURE_NAMES[0]);
+
+	// "TEXTURE,AMBIENT" 처럼 쉼표로 나눈 이름(USE_ 는 생략 가능)을 비트로 바꾼다. 모르는 이름은 무시한다.
+	std::uint32_t Parse(const std::string& list);
+	// 비트를 "#define USE_TEXTURE\n..." 줄들로 바꾼다.
+	std::string ToDefines(std::uint32_t features);
+}
+
+// 소스 한 벌(.vs/.fs)에서 #define 으로 갈라지는 셰이더 변형들.
+// 변형은 처음 요청할 때 컴파일하고 기능 비트를 키로 보관한다. 시작할 때 모든 조합을 컴파일하지 않는다.
+// 프로그램은 ShaderCache 에서 받으므로 디스크 바이너리 캐시와 핫 리로드도 변형마다 그대로 적용된다.
+class ShaderFamily
+{
+public:
+	ShaderFamily();
+	~ShaderFamily();
+
+	// basePath 는 확장자를 뺀 경로. ("../resources/shaders/Rim")
+	void Initialize(ShaderCache* cache, const std::string& basePath, const std::string& name);
+
+	// features 조합의 프로그램. 컴파일에 실패한 조합은 기억해 두고 다시 시도하지 않는다. (nullptr)
+	std::shared_ptr<ShaderProgram> Get(std::uint32_t features);
+
+	const std::string& GetName() const { return mName; }
+	int GetVariantCount() const { return static_cast<int>(mVariants.size()); }
+	// 변형을 놓는다. GL 컨텍스트가 없어지기 전에 호출한다.
+	void Clear();
+
+private:
+	std::string GetVariantName(std::uint32_t features) const;
+
+private:
+	ShaderCache* mCache{};
+	std::string mBasePath{};
+	std::string mName{};
+	std::unordered_map<std::uint32_t, std::shared_ptr<ShaderProgram>> mVariants{};
+};
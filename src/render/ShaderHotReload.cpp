@@ -0,0 +1,151 @@
+#include "render/ShaderHotReload.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "glad/glad.h"
+
+#include "core/Profiler.h"
+#include "render/ParallelShaderCompile.h"
+#include "render/ShaderCache.h"
+#include "render/ShaderProgram.h"
+
+//-----------------------------------------------------------------------------
+ShaderHotReload::ShaderHotReload()
+{
+}
+
+//-----------------------------------------------------------------------------
+ShaderHotReload::~ShaderHotReload()
+{
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderHotReload::Initialize(ShaderCache* cache, const std::string& directory)
+{
+	Shutdown();
+	if (!mWatcher.Watch(directory)) {
+		return false;
+	}
+
+	mCache = cache;
+	mReloadCount = 0;
+	mFailureCount = 0;
+	ParallelShaderCompile::Initialize();
+	std::cout << "[ShaderHotReload] watching " << directory
+		<< (mWatcher.IsPolling() ? " (polling)" : " (inotify)")
+		<< (ParallelShaderCompile::IsSupported() ? ", parallel compile" : "") << std::endl;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void ShaderHotReload::Shutdown()
+{
+	for (PendingBuild& pending : mPending) {
+		glDeleteProgram(pending.program);
+	}
+	mPending.clear();
+	mWatcher.Stop();
+	mCache = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+void ShaderHotReload::Update()
+{
+	if (mCache == nullptr) {
+		return;
+	}
+
+	PROFILE_SCOPE("ShaderHotReload::Update");
+	std::vector<std::string> changedFiles = mWatcher.Poll();
+	if (!changedFiles.empty()) {
+		SubmitChangedPrograms(changedFiles);
+	}
+	if (!mPending.empty()) {
+		FinishPendingBuilds();
+	}
+}
+
+//-----------------------------------------------------------------------------
+void ShaderHotReload::SubmitChangedPrograms(const std::vector<std::string>& changedFiles)
+{
+	for (const ShaderCache::FileBinding& binding : mCache->GetFileBindings()) {
+		std::shared_ptr<ShaderProgram> target = binding.program.lock();
+		if (target == nullptr) {
+			continue;
+		}
+		bool changed = std::find(changedFiles.begin(), changedFiles.end(), binding.vertexPath) != changedFiles.end()
+			|| std::find(changedFiles.begin(), changedFiles.end(), binding.fragmentPath) != changedFiles.end();
+		if (!changed) {
+			continue;
+		}
+
+		PendingBuild build{};
+		if (!ShaderCache::ReadSourceFile(binding.vertexPath, build.vertexSource)
+			|| !ShaderCache::ReadSourceFile(binding.fragmentPath, build.fragmentSource)) {
+			continue;
+		}
+		ShaderCache::InjectDefines(build.vertexSource, binding.defines);
+		ShaderCache::InjectDefines(build.fragmentSource, binding.defines);
+
+		// 저장만 하고 내용이 같으면 다시 컴파일할 필요가 없다.
+		std::string currentVertex{};
+		std::string currentFragment{};
+		if (mCache->GetSources(target.get(), currentVertex, currentFragment)
+			&& currentVertex == build.vertexSource && currentFragment == build.fragmentSource) {
+			continue;
+		}
+
+		// 같은 프로그램의 이전 빌드가 아직 진행 중이면 버리고 최신 소스만 남긴다.
+		for (auto it = mPending.begin(); it != mPending.end();) {
+			if (it->target.lock() == target) {
+				glDeleteProgram(it->program);
+				it = mPending.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+
+		build.target = target;
+		build.name = binding.name;
+		build.program = ShaderProgram::SubmitBuild(build.vertexSource, build.fragmentSource, mCache->GetBinaryCache().IsEnabled());
+		mPending.push_back(std::move(build));
+		std::cout << "[ShaderHotReload] recompiling " << binding.name << std::endl;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void ShaderHotReload::FinishPendingBuilds()
+{
+	for (auto it = mPending.begin(); it != mPending.end();) {
+		PendingBuild& build = *it;
+		++build.framesWaited;
+
+		// 확장이 없으면 완료 여부를 물을 방법이 없다. 드라이버가 뒤에서 컴파일할 시간을 한 프레임 주고 마무리한다.
+		bool complete = ParallelShaderCompile::IsSupported()
+			? ParallelShaderCompile::IsProgramComplete(build.program)
+			: build.framesWaited > 1;
+		if (!complete) {
+			++it;
+			continue;
+		}
+
+		std::shared_ptr<ShaderProgram> target = build.target.lock();
+		if (target == nullptr) {
+			glDeleteProgram(build.program);
+		}
+		else if (ShaderProgram::FinishBuild(build.program, build.name)) {
+			// 링크에 성공했을 때만 바꾼다. 이 프로그램을 쥐고 있는 모든 곳이 다음 그리기부터 새 프로그램을 쓴다.
+			mCache->ReplaceSources(target.get(), build.program, build.vertexSource, build.fragmentSource);
+			++mReloadCount;
+			std::cout << "[ShaderHotReload] reloaded " << build.name << std::endl;
+		}
+		else {
+			// FinishBuild 가 실패한 프로그램을 지웠다. 이전 프로그램으로 계속 그린다.
+			++mFailureCount;
+			std::cout << "[ShaderHotReload] keeping previous " << build.name << std::endl;
+		}
+		it = mPending.erase(it);
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/FileWatcher.h"
+
+class ShaderCache;
+class ShaderProgram;
+
+// 셰이더 폴더를 감시하다가 파일이 바뀌면 그 파일로 만든 프로그램을 다시 컴파일한다.
+// 컴파일/링크 명령만 넣어 두고 다음 프레임들에서 완료 여부를 확인하므로 프레임 루프를 멈추지 않는다.
+// (GL_KHR_parallel_shader_compile 이 있으면 GL_COMPLETION_STATUS 로 확인한다)
+// 링크에 성공한 경우에만 프로그램을 바꾸고, 실패하면 로그만 남기고 이전 프로그램을 계속 쓴다.
+class ShaderHotReload
+{
+public:
+	ShaderHotReload();
+	~ShaderHotReload();
+
+	// GL 컨텍스트를 가진 스레드에서 호출한다.
+	bool Initialize(ShaderCache* cache, const std::string& directory);
+	void Shutdown();
+
+	// 매 프레임 렌더링 전에 호출한다.
+	void Update();
+
+	bool IsEnabled() const { return mCache != nullptr; }
+	int GetReloadCount() const { return mReloadCount; }
+	int GetFailureCount() const { return mFailureCount; }
+
+private:
+	struct PendingBuild
+	{
+		std::weak_ptr<ShaderProgram> target{};
+		std::string name{};
+		std::string vertexSource{};
+		std::string fragmentSource{};
+		unsigned int program{};
+		int framesWaited{};
+	};
+
+	void SubmitChangedPrograms(const std::vector<std::string>& changedFiles);
+	void FinishPendingBuilds();
+
+private:
+	ShaderCache* mCache{};
+	FileWatcher mWatcher{};
+	std::vector<PendingBuild> mPending{};
+	int mReloadCount{};
+	int mFailureCount{};
+};
@@ -0,0 +1,218 @@
+#include "render/ShaderLibrary.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+
+#include "core/Profiler.h"
+#include "render/ParallelShaderCompile.h"
+#include "render/ShaderCache.h"
+#include "render/ShaderProgram.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+//-----------------------------------------------------------------------------
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+ShaderLibrary::ShaderLibrary()
+{
+}
+
+//-----------------------------------------------------------------------------
+ShaderLibrary::~ShaderLibrary()
+{
+}
+
+//-----------------------------------------------------------------------------
+int ShaderLibrary::AddDirectory(const std::string& directory)
+{
+	std::error_code error{};
+	std::vector<fs::path> vertexFiles{};
+	for (const fs::directory_entry& entry : fs::directory_iterator(directory, error)) {
+		if (entry.is_regular_file(error) && entry.path().extension() == ".vs") {
+			vertexFiles.push_back(entry.path());
+		}
+	}
+	if (error) {
+		std::cout << "[ShaderLibrary] failed to read " << directory << ": " << error.message() << std::endl;
+		return 0;
+	}
+	std::sort(vertexFiles.begin(), vertexFiles.end());
+
+	int added = 0;
+	for (const fs::path& vertexPath : vertexFiles) {
+		fs::path fragmentPath = vertexPath;
+		fragmentPath.replace_extension(".fs");
+		if (!fs::exists(fragmentPath, error)) {
+			std::cout << "[ShaderLibrary] no matching .fs for " << vertexPath.filename().string() << ", skipped" << std::endl;
+			continue;
+		}
+		Add(vertexPath.stem().string(), vertexPath.string(), fragmentPath.string());
+		++added;
+	}
+	return added;
+}
+
+//-----------------------------------------------------------------------------
+void ShaderLibrary::Add(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath)
+{
+	ProgramSource source{};
+	source.name = name;
+	source.vertexPath = vertexPath;
+	source.fragmentPath = fragmentPath;
+	mSources.push_back(std::move(source));
+}
+
+//-----------------------------------------------------------------------------
+void ShaderLibrary::ReadSources(int ioThreadCount)
+{
+	PROFILE_SCOPE("ShaderLibrary::ReadSources");
+	// 파일 하나 = 작업 하나. 작업 스레드들이 번호를 하나씩 가져가서 읽는다.
+	std::atomic<std::size_t> nextJob{ 0 };
+	std::size_t jobCount = mSources.size() * 2;
+	auto worker = [this, &nextJob, jobCount]() {
+		if (Profiler::IsEnabled()) {
+			Profiler::SetThreadName("shader-io");
+		}
+		for (std::size_t job = nextJob++; job < jobCount; job = nextJob++) {
+			PROFILE_SCOPE("ShaderLibrary::ReadFile");
+			ProgramSource& source = mSources[job / 2];
+			bool vertex = (job % 2) == 0;
+			std::string& text = vertex ? source.vertexSource : source.fragmentSource;
+			if (!ShaderCache::ReadSourceFile(vertex ? source.vertexPath : source.fragmentPath, text)) {
+				text.clear();
+			}
+		}
+	};
+
+	int threadCount = (ioThreadCount > 0) ? ioThreadCount : static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+	threadCount = std::min(threadCount, static_cast<int>(jobCount));
+	std::vector<std::thread> threads{};
+	for (int i = 0; i < threadCount; ++i) {
+		threads.emplace_back(worker);
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	for (ProgramSource& source : mSources) {
+		source.readOk = !source.vertexSource.empty() && !source.fragmentSource.empty();
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderLibrary::Load(ShaderCache& cache, int ioThreadCount)
+{
+	PROFILE_SCOPE("ShaderLibrary::Load");
+	mStats = LoadStats{};
+	mStats.programCount = static_cast<int>(mSources.size());
+	if (mSources.empty()) {
+		return true;
+	}
+
+	auto readStart = std::chrono::steady_clock::now();
+	ReadSources(ioThreadCount);
+	mStats.readMs = ElapsedMs(readStart);
+
+	// 캐시에 없는 것들은 컴파일/링크 명령만 먼저 모두 넣는다. 여기서 상태를 물으면 하나씩 기다리게 된다.
+	auto submitStart = std::chrono::steady_clock::now();
+	ParallelShaderCompile::Initialize();
+	struct PendingBuild
+	{
+		ProgramSource* source{};
+		unsigned int program{};
+	};
+	std::vector<PendingBuild> pending{};
+	for (ProgramSource& source : mSources) {
+		if (!source.readOk) {
+			++mStats.failed;
+			continue;
+		}
+
+		std::shared_ptr<ShaderProgram> program = cache.Find(source.vertexSource, source.fragmentSource);
+		if (program != nullptr) {
+			++mStats.fromMemoryCache;
+		}
+		else if ((program = cache.LoadFromBinary(source.vertexSource, source.fragmentSource, source.name)) != nullptr) {
+			++mStats.fromBinaryCache;
+		}
+		if (program != nullptr) {
+			mPrograms[source.name] = program;
+			cache.AddFileBinding(source.vertexPath, source.fragmentPath, source.name, program);
+			continue;
+		}
+
+		pending.push_back(PendingBuild{ &source,
+			ShaderProgram::SubmitBuild(source.vertexSource, source.fragmentSource, cache.GetBinaryCache().IsEnabled()) });
+	}
+	mStats.submitMs = ElapsedMs(submitStart);
+
+	// 끝난 것부터 마무리한다. 병렬 컴파일 확장이 없으면 완료 확인이 항상 true 라서 순서대로 기다리게 된다.
+	auto waitStart = std::chrono::steady_clock::now();
+	while (!pending.empty()) {
+		bool progressed = false;
+		for (auto it = pending.begin(); it != pending.end();) {
+			if (!ParallelShaderCompile::IsProgramComplete(it->program)) {
+				++it;
+				continue;
+			}
+
+			ProgramSource& source = *it->source;
+			if (ShaderProgram::FinishBuild(it->program, source.name)) {
+				std::shared_ptr<ShaderProgram> program = cache.Adopt(source.vertexSource, source.fragmentSource, source.name, it->program);
+				mPrograms[source.name] = program;
+				cache.AddFileBinding(source.vertexPath, source.fragmentPath, source.name, program);
+				++mStats.compiled;
+			}
+			else {
+				++mStats.failed;
+			}
+			it = pending.erase(it);
+			progressed = true;
+		}
+		if (!progressed) {
+			std::this_thread::yield();
+		}
+	}
+	mStats.waitMs = ElapsedMs(waitStart);
+
+	// 소스는 캐시에 들어갔으므로 여기서는 놓는다.
+	for (ProgramSource& source : mSources) {
+		source.vertexSource.clear();
+		source.vertexSource.shrink_to_fit();
+		source.fragmentSource.clear();
+		source.fragmentSource.shrink_to_fit();
+	}
+
+	std::cout << "[ShaderLibrary] " << mStats.programCount << " programs: "
+		<< mStats.compiled << " compiled, " << mStats.fromBinaryCache << " from binary cache, "
+		<< mStats.fromMemoryCache << " already cached, " << mStats.failed << " failed"
+		<< " (read " << mStats.readMs << " ms, submit " << mStats.submitMs << " ms, wait " << mStats.waitMs << " ms"
+		<< (ParallelShaderCompile::IsSupported() ? ", parallel compile)" : ")") << std::endl;
+	return mStats.failed == 0;
+}
+
+//-----------------------------------------------------------------------------
+std::shared_ptr<ShaderProgram> ShaderLibrary::Get(const std::string& name) const
+{
+	auto found = mPrograms.find(name);
+	return (found != mPrograms.end()) ? found->second : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+void ShaderLibrary::Clear()
+{
+	mPrograms.clear();
+	mSources.clear();
+}
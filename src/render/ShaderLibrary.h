@@ -0,0 +1,64 @@
+#pragma once
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class ShaderCache;
+class ShaderProgram;
+
+// 셰이더 폴더 전체를 시작할 때 한꺼번에 읽고 컴파일한다.
+// 1. 작업 스레드들이 .vs/.fs 파일을 동시에 읽는다. (BOM 제거, 줄바꿈 정리까지 작업 스레드에서 끝난다)
+// 2. GL 스레드에서 캐시(메모리, 디스크 바이너리)에 없는 프로그램의 컴파일/링크 명령을 모두 먼저 넣는다.
+// 3. 그 다음에 한꺼번에 완료를 기다린다. GL_KHR_parallel_shader_compile 이 있으면 드라이버가 여러 스레드로 컴파일한다.
+// 만든 프로그램은 ShaderCache 에 들어가므로 이후 GetOrCreate/GetOrCreateFromFiles 는 캐시에서 바로 나온다.
+class ShaderLibrary
+{
+public:
+	// 한 번 불러온 결과.
+	struct LoadStats
+	{
+		int programCount{};
+		int fromMemoryCache{};
+		int fromBinaryCache{};
+		int compiled{};
+		int failed{};
+		double readMs{};
+		double submitMs{};
+		double waitMs{};
+	};
+
+	ShaderLibrary();
+	~ShaderLibrary();
+
+	// 같은 이름의 .vs/.fs 를 짝지어 등록한다. 짝이 없는 파일은 건너뛴다.
+	int AddDirectory(const std::string& directory);
+	// 이름이 다른 파일끼리 짝지을 때 직접 등록한다.
+	void Add(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath);
+
+	// 등록된 프로그램을 모두 만든다. GL 컨텍스트를 가진 스레드에서 호출한다.
+	bool Load(ShaderCache& cache, int ioThreadCount = 0);
+
+	std::shared_ptr<ShaderProgram> Get(const std::string& name) const;
+	const LoadStats& GetLoadStats() const { return mStats; }
+	// 프로그램을 놓는다. GL 컨텍스트가 없어지기 전에 호출한다.
+	void Clear();
+
+private:
+	struct ProgramSource
+	{
+		std::string name{};
+		std::string vertexPath{};
+		std::string fragmentPath{};
+		std::string vertexSource{};
+		std::string fragmentSource{};
+		bool readOk{};
+	};
+
+	void ReadSources(int ioThreadCount);
+
+private:
+	std::vector<ProgramSource> mSources{};
+	std::map<std::string, std::shared_ptr<ShaderProgram>> mPrograms{};
+	LoadStats mStats{};
+};
@@ -0,0 +1,436 @@
+#include "render/ShaderProgram.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "glad/glad.h"
+#include "glm/gtc/type_ptr.hpp"
+
+#include "render/GlState.h"
+#include "render/UniformBlocks.h"
+
+namespace {
+
+// 샘플러 타입이면 true. (유닛 번호는 int 로 쓴다)
+bool IsSamplerType(GLenum type)
+{
+	switch (type) {
+	case GL_SAMPLER_1D:
+	case GL_SAMPLER_2D:
+	case GL_SAMPLER_3D:
+	case GL_SAMPLER_CUBE:
+	case GL_SAMPLER_2D_SHADOW:
+	case GL_SAMPLER_2D_ARRAY:
+	case GL_SAMPLER_2D_ARRAY_SHADOW:
+	case GL_SAMPLER_CUBE_SHADOW:
+	case GL_SAMPLER_2D_MULTISAMPLE:
+	case GL_SAMPLER_BUFFER:
+	case GL_INT_SAMPLER_2D:
+	case GL_UNSIGNED_INT_SAMPLER_2D:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// 유니폼 타입 하나가 차지하는 shadow 크기. 모르는 타입은 mat4 크기로 넉넉하게 잡는다.
+std::uint32_t GetShadowSize(GLenum type)
+{
+	switch (type) {
+	case GL_FLOAT:
+	case GL_INT:
+	case GL_UNSIGNED_INT:
+	case GL_BOOL:
+		return 4;
+	case GL_FLOAT_VEC2:
+		return 8;
+	case GL_FLOAT_VEC3:
+		return 12;
+	case GL_FLOAT_VEC4:
+		return 16;
+	case GL_FLOAT_MAT3:
+		return 36;
+	default:
+		return IsSamplerType(type) ? 4 : 64;
+	}
+}
+
+} // namespace
+
+//-----------------------------------------------------------------------------
+ShaderProgram::ShaderProgram()
+{
+}
+
+//-----------------------------------------------------------------------------
+ShaderProgram::~ShaderProgram()
+{
+	if (mProgramId != 0) {
+		GlState::ForgetProgram(mProgramId);
+		glDeleteProgram(mProgramId);
+	}
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderProgram::Build(const std::string& vertexSource, const std::string& fragmentSource, const std::string& name, bool retrievable)
+{
+	mName = name;
+	unsigned int program = SubmitBuild(vertexSource, fragmentSource, retrievable);
+	if (!FinishBuild(program, name)) {
+		return false;
+	}
+	ReplaceProgram(program);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+unsigned int ShaderProgram::SubmitBuild(const std::string& vertexSource, const std::string& fragmentSource, bool retrievable)
+{
+	const char* vertexCode = vertexSource.c_str();
+	const char* fragmentCode = fragmentSource.c_str();
+
+	unsigned int vertex = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(vertex, 1, &vertexCode, nullptr);
+	glCompileShader(vertex);
+
+	unsigned int fragment = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(fragment, 1, &fragmentCode, nullptr);
+	glCompileShader(fragment);
+
+	// 컴파일 결과를 여기서 확인하면 드라이버가 컴파일이 끝날 때까지 기다리므로, 확인은 FinishBuild 에서 한다.
+	unsigned int program = glCreateProgram();
+	glAttachShader(program, vertex);
+	glAttachShader(program, fragment);
+	if (retrievable) {
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+	glLinkProgram(program);
+	return program;
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderProgram::FinishBuild(unsigned int program, const std::string& name)
+{
+	GLuint shaders[2]{};
+	GLsizei shaderCount = 0;
+	glGetAttachedShaders(program, 2, &shaderCount, shaders);
+
+	bool success = CheckLinkStatus(program, name);
+	for (GLsizei i = 0; i < shaderCount; ++i) {
+		// 링크가 실패했으면 원인이 된 셰이더의 컴파일 로그를 보여준다.
+		if (!success) {
+			GLint type{};
+			glGetShaderiv(shaders[i], GL_SHADER_TYPE, &type);
+			CheckCompileStatus(shaders[i], (type == GL_VERTEX_SHADER) ? "VERTEX" : "FRAGMENT", name);
+		}
+		// 링크가 끝난 셰이더 객체는 더 이상 필요 없다.
+		glDetachShader(program, shaders[i]);
+		glDeleteShader(shaders[i]);
+	}
+
+	if (!success) {
+		glDeleteProgram(program);
+	}
+	return success;
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::ReplaceProgram(unsigned int program)
+{
+	if (mProgramId != 0) {
+		GlState::ForgetProgram(mProgramId);
+		glDeleteProgram(mProgramId);
+	}
+	mProgramId = program;
+	ReflectUniforms();
+	BindUniformBlocks();
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderProgram::LoadBinary(unsigned int format, const void* data, int length, const std::string& name)
+{
+	mName = name;
+
+	unsigned int program = glCreateProgram();
+	glProgramBinary(program, format, data, length);
+	// 포맷이 안 맞거나 드라이버가 바뀌었으면 링크 실패로 나온다. 이건 오류가 아니므로 로그는 남기지 않는다.
+	GLint success{};
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success) {
+		glDeleteProgram(program);
+		return false;
+	}
+
+	ReplaceProgram(program);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderProgram::GetBinary(unsigned int& format, std::vector<std::uint8_t>& data) const
+{
+	if (mProgramId == 0) {
+		return false;
+	}
+
+	GLint length{};
+	glGetProgramiv(mProgramId, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) {
+		return false;
+	}
+
+	data.resize(length);
+	GLsizei written{};
+	GLenum binaryFormat{};
+	glGetProgramBinary(mProgramId, length, &written, &binaryFormat, data.data());
+	data.resize(written);
+	format = binaryFormat;
+	return written > 0;
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::Use() const
+{
+	GlState::UseProgram(mProgramId);
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::ReflectUniforms()
+{
+	// 다시 링크된 경우(핫 리로드) 이미 나눠 준 핸들이 그대로 맞도록 기존 유니폼의 순서는 유지한다.
+	// 없어진 유니폼은 location 을 -1 로 두어 쓰기를 무시한다.
+	std::vector<UniformInfo> previous = std::move(mUniforms);
+	std::vector<std::uint8_t> previousShadow = std::move(mShadow);
+	mUniforms.clear();
+	mShadow.clear();
+	for (const UniformInfo& old : previous) {
+		UniformInfo info = old;
+		info.location = -1;
+		info.shadowValid = false;
+		info.shadowOffset = static_cast<std::uint32_t>(mShadow.size());
+		mShadow.resize(mShadow.size() + GetShadowSize(info.type));
+		mUniforms.push_back(info);
+	}
+
+	GLint count = 0;
+	glGetProgramInterfaceiv(mProgramId, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+
+	const GLenum PROPERTIES[] = { GL_NAME_LENGTH, GL_TYPE, GL_LOCATION, GL_ARRAY_SIZE, GL_BLOCK_INDEX };
+	const GLsizei PROPERTY_COUNT = sizeof(PROPERTIES) / sizeof(PROPERTIES[0]);
+	std::vector<char> nameBuffer{};
+	for (GLint i = 0; i < count; ++i) {
+		GLint values[PROPERTY_COUNT]{};
+		glGetProgramResourceiv(mProgramId, GL_UNIFORM, i, PROPERTY_COUNT, PROPERTIES, PROPERTY_COUNT, nullptr, values);
+		// uniform block 멤버는 location 이 없다. (버퍼로 채운다)
+		if (values[4] != -1 || values[2] < 0) {
+			continue;
+		}
+
+		nameBuffer.assign(static_cast<std::size_t>(values[0]) + 1, '\0');
+		glGetProgramResourceName(mProgramId, GL_UNIFORM, i, values[0], nullptr, nameBuffer.data());
+
+		std::string name = nameBuffer.data();
+		// 배열은 "name[0]" 으로 나오므로 "name" 으로도 찾을 수 있게 잘라 둔다.
+		std::string::size_type bracket = name.find('[');
+		if (bracket != std::string::npos) {
+			name.resize(bracket);
+		}
+		GLenum type = static_cast<GLenum>(values[1]);
+
+		UniformInfo* info = nullptr;
+		for (UniformInfo& existing : mUniforms) {
+			if (existing.name == name && existing.type == type) {
+				info = &existing;
+				break;
+			}
+		}
+		if (info == nullptr) {
+			mUniforms.push_back(UniformInfo{});
+			info = &mUniforms.back();
+			info->name = name;
+			info->type = type;
+			info->shadowOffset = static_cast<std::uint32_t>(mShadow.size());
+			mShadow.resize(mShadow.size() + GetShadowSize(type));
+		}
+		info->location = values[2];
+		info->arraySize = values[3];
+	}
+
+	// 이전 프로그램에 써 두었던 값(샘플러 유닛 등)을 새 프로그램에 다시 쓴다.
+	for (std::size_t i = 0; i < previous.size(); ++i) {
+		UniformInfo& info = mUniforms[i];
+		if (!previous[i].shadowValid || info.location < 0) {
+			continue;
+		}
+		const std::uint8_t* value = previousShadow.data() + previous[i].shadowOffset;
+		std::memcpy(mShadow.data() + info.shadowOffset, value, GetShadowSize(info.type));
+		info.shadowValid = true;
+		switch (info.type) {
+		case GL_FLOAT:		ApplyUniform(info.location, *reinterpret_cast<const float*>(value)); break;
+		case GL_FLOAT_VEC2:	ApplyUniform(info.location, *reinterpret_cast<const glm::vec2*>(value)); break;
+		case GL_FLOAT_VEC3:	ApplyUniform(info.location, *reinterpret_cast<const glm::vec3*>(value)); break;
+		case GL_FLOAT_VEC4:	ApplyUniform(info.location, *reinterpret_cast<const glm::vec4*>(value)); break;
+		case GL_FLOAT_MAT3:	ApplyUniform(info.location, *reinterpret_cast<const glm::mat3*>(value)); break;
+		case GL_FLOAT_MAT4:	ApplyUniform(info.location, *reinterpret_cast<const glm::mat4*>(value)); break;
+		default:
+			if (info.type == GL_INT || IsSamplerType(info.type)) {
+				ApplyUniform(info.location, *reinterpret_cast<const int*>(value));
+			}
+			else {
+				info.shadowValid = false;
+			}
+			break;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::BindUniformBlocks()
+{
+	GLint count = 0;
+	glGetProgramInterfaceiv(mProgramId, GL_UNIFORM_BLOCK, GL_ACTIVE_RESOURCES, &count);
+
+	const GLenum PROPERTIES[] = { GL_NAME_LENGTH, GL_BUFFER_DATA_SIZE };
+	const GLsizei PROPERTY_COUNT = sizeof(PROPERTIES) / sizeof(PROPERTIES[0]);
+	std::vector<char> nameBuffer{};
+	for (GLint i = 0; i < count; ++i) {
+		GLint values[PROPERTY_COUNT]{};
+		glGetProgramResourceiv(mProgramId, GL_UNIFORM_BLOCK, i, PROPERTY_COUNT, PROPERTIES, PROPERTY_COUNT, nullptr, values);
+		nameBuffer.assign(static_cast<std::size_t>(values[0]) + 1, '\0');
+		glGetProgramResourceName(mProgramId, GL_UNIFORM_BLOCK, i, values[0], nullptr, nameBuffer.data());
+
+		const UniformBlockBinding::BlockInfo* block = UniformBlockBinding::Find(nameBuffer.data());
+		if (block == nullptr) {
+			std::cout << "[warning] unknown uniform block. program: " << mName << ", block: " << nameBuffer.data() << std::endl;
+			continue;
+		}
+		// std140 이면 크기가 C++ 구조체와 같아야 한다. 다르면 셰이더와 UniformBlocks.h 중 한쪽만 고친 것이다.
+		if (static_cast<std::size_t>(values[1]) > block->size) {
+			std::cout << "[warning] uniform block size mismatch. program: " << mName << ", block: " << block->name
+				<< ", shader " << values[1] << " bytes, C++ " << block->size << " bytes" << std::endl;
+		}
+		glUniformBlockBinding(mProgramId, static_cast<GLuint>(i), block->binding);
+	}
+}
+
+//-----------------------------------------------------------------------------
+int ShaderProgram::FindUniform(const std::string& name, unsigned int type) const
+{
+	for (std::size_t i = 0; i < mUniforms.size(); ++i) {
+		const UniformInfo& info = mUniforms[i];
+		if (info.name != name || info.location < 0) {
+			continue;
+		}
+		// 샘플러는 int 로 유닛 번호를 쓴다.
+		bool typeMatches = (info.type == type) || (type == GL_INT && IsSamplerType(info.type));
+		if (!typeMatches) {
+			std::cout << "[warning] uniform type mismatch. program: " << mName << ", uniform: " << name << std::endl;
+			return -1;
+		}
+		return static_cast<int>(i);
+	}
+	return -1;
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderProgram::UpdateShadow(int index, const void* value, std::uint32_t size)
+{
+	UniformInfo& info = mUniforms[index];
+	std::uint8_t* shadow = mShadow.data() + info.shadowOffset;
+	if (info.shadowValid && std::memcmp(shadow, value, size) == 0) {
+		++mSkippedUniformWrites;
+		return false;
+	}
+	std::memcpy(shadow, value, size);
+	info.shadowValid = true;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderProgram::SetSampler(const std::string& name, int unit)
+{
+	UniformHandle<int> handle = GetUniform<int>(name);
+	if (!handle.IsValid()) {
+		return false;
+	}
+	SetUniform(handle, unit);
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::ApplyUniform(int location, float value)
+{
+	glProgramUniform1f(mProgramId, location, value);
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::ApplyUniform(int location, int value)
+{
+	glProgramUniform1i(mProgramId, location, value);
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::ApplyUniform(int location, const glm::vec2& value)
+{
+	glProgramUniform2fv(mProgramId, location, 1, glm::value_ptr(value));
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::ApplyUniform(int location, const glm::vec3& value)
+{
+	glProgramUniform3fv(mProgramId, location, 1, glm::value_ptr(value));
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::ApplyUniform(int location, const glm::vec4& value)
+{
+	glProgramUniform4fv(mProgramId, location, 1, glm::value_ptr(value));
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::ApplyUniform(int location, const glm::mat3& value)
+{
+	glProgramUniformMatrix3fv(mProgramId, location, 1, GL_FALSE, glm::value_ptr(value));
+}
+
+//-----------------------------------------------------------------------------
+void ShaderProgram::ApplyUniform(int location, const glm::mat4& value)
+{
+	glProgramUniformMatrix4fv(mProgramId, location, 1, GL_FALSE, glm::value_ptr(value));
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderProgram::CheckCompileStatus(unsigned int shader, const char* stage, const std::string& name)
+{
+	GLint success{};
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+	if (success) {
+		return true;
+	}
+
+	GLint length{};
+	glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+	std::vector<GLchar> errorLog(static_cast<std::size_t>(length) + 1, '\0');
+	glGetShaderInfoLog(shader, length, nullptr, errorLog.data());
+	std::cout << "[error] shader compilation error. program: " << name << ", type: " << stage << std::endl;
+	std::cout << "log : " << errorLog.data() << std::endl;
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+bool ShaderProgram::CheckLinkStatus(unsigned int program, const std::string& name)
+{
+	GLint success{};
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (success) {
+		return true;
+	}
+
+	GLint length{};
+	glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+	std::vector<GLchar> errorLog(static_cast<std::size_t>(length) + 1, '\0');
+	glGetProgramInfoLog(program, length, nullptr, errorLog.data());
+	std::cout << "[error] shader program linking error. program: " << name << std::endl;
+	std::cout << "log : " << errorLog.data() << std::endl;
+	return false;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "render/Uniform.h"
+
+// 버텍스 + 프래그먼트 셰이더를 컴파일/링크한 프로그램 하나.
+// 보통 직접 만들지 않고 ShaderCache 에서 받아서 여러 곳이 같이 쓴다.
+// GL 프로그램은 소멸자에서 지우므로 GL 컨텍스트가 살아 있을 때 놓아야 한다.
+// 링크할 때 유니폼 목록을 한 번 읽어 두고, 유니폼 쓰기는 마지막 값과 같으면 건너뛴다.
+// (glProgramUniform* 을 쓰므로 프로그램을 바인딩하지 않아도 된다)
+// uniform block 은 이름으로 고정된 바인딩 위치에 연결되므로 버퍼만 그 위치에 바인딩하면 된다.
+class ShaderProgram
+{
+public:
+	ShaderProgram();
+	~ShaderProgram();
+
+	ShaderProgram(const ShaderProgram&) = delete;
+	ShaderProgram& operator=(const ShaderProgram&) = delete;
+
+	// 컴파일과 링크. 실패하면 로그를 출력하고 false.
+	// retrievable 이면 링크 후 GetBinary 로 바이너리를 꺼낼 수 있게 힌트를 준다.
+	bool Build(const std::string& vertexSource, const std::string& fragmentSource, const std::string& name, bool retrievable = false);
+	// 컴파일과 링크 명령만 넣고 결과는 기다리지 않는다. 돌려준 프로그램은 FinishBuild 로 마무리한다.
+	// (GL_KHR_parallel_shader_compile 이 있으면 그 사이 드라이버 스레드에서 컴파일된다)
+	static unsigned int SubmitBuild(const std::string& vertexSource, const std::string& fragmentSource, bool retrievable);
+	// 링크 결과를 확인하고 셰이더 객체를 정리한다. 실패하면 로그를 출력하고 프로그램을 지운다.
+	static bool FinishBuild(unsigned int program, const std::string& name);
+	// 링크가 끝난 프로그램으로 바꾼다. 이 객체를 쥐고 있는 곳은 다음 그리기부터 새 프로그램을 쓴다.
+	// 유니폼 핸들은 그대로 쓸 수 있고, 이전에 쓴 값은 새 프로그램에 다시 써 준다.
+	void ReplaceProgram(unsigned int program);
+	// glGetProgramBinary 로 얻은 바이너리로 프로그램을 만든다. 드라이버가 거부하면 false.
+	bool LoadBinary(unsigned int format, const void* data, int length, const std::string& name);
+	bool GetBinary(unsigned int& format, std::vector<std::uint8_t>& data) const;
+
+	void Use() const;
+
+	bool IsValid() const { return mProgramId != 0; }
+	unsigned int GetId() const { return mProgramId; }
+	const std::string& GetName() const { return mName; }
+	void SetName(const std::string& name) { mName = name; }
+
+	// 유니폼 핸들을 얻는다. 이름이 없거나 타입이 다르면 무효 핸들.
+	template <typename T>
+	UniformHandle<T> GetUniform(const std::string& name) const
+	{
+		return UniformHandle<T>{ FindUniform(name, UniformTraits<T>::GLSL_TYPE) };
+	}
+
+	// 값이 바뀌었을 때만 GL 에 쓴다.
+	template <typename T>
+	void SetUniform(UniformHandle<T> handle, const T& value)
+	{
+		if (handle.IsValid() && UpdateShadow(handle.index, &value, sizeof(T))) {
+			ApplyUniform(mUniforms[handle.index].location, value);
+		}
+	}
+
+	// 샘플러 유니폼에 텍스처 유닛을 지정한다. 초기화할 때 한 번만 부르면 된다.
+	bool SetSampler(const std::string& name, int unit);
+
+	const std::vector<UniformInfo>& GetUniforms() const { return mUniforms; }
+	// 값이 같아서 건너뛴 유니폼 쓰기 횟수.
+	std::uint64_t GetSkippedUniformWrites() const { return mSkippedUniformWrites; }
+
+	// 셰이더/프로그램 상태를 확인하고 실패했으면 로그를 출력한다.
+	static bool CheckCompileStatus(unsigned int shader, const char* stage, const std::string& name);
+	static bool CheckLinkStatus(unsigned int program, const std::string& name);
+
+private:
+	// 링크된 프로그램의 유니폼 목록을 읽는다. (uniform block 안의 멤버는 제외)
+	void ReflectUniforms();
+	// uniform block 을 UniformBlocks.h 에 정해 둔 바인딩 위치에 연결한다.
+	void BindUniformBlocks();
+	int FindUniform(const std::string& name, unsigned int type) const;
+	// 마지막 값과 다르면 보관하고 true.
+	bool UpdateShadow(int index, const void* value, std::uint32_t size);
+
+	void ApplyUniform(int location, float value);
+	void ApplyUniform(int location, int value);
+	void ApplyUniform(int location, const glm::vec2& value);
+	void ApplyUniform(int location, const glm::vec3& value);
+	void ApplyUniform(int location, const glm::vec4& value);
+	void ApplyUniform(int location, const glm::mat3& value);
+	void ApplyUniform(int location, const glm::mat4& value);
+
+private:
+	unsigned int mProgramId{};
+	std::string mName{};
+
+	std::vector<UniformInfo> mUniforms{};
+	std::vector<std::uint8_t> mShadow{};
+	std::uint64_t mSkippedUniformWrites{};
+};
@@ -0,0 +1,162 @@
+#include "render/StreamingBuffer.h"
+
+#include <cstring>
+#include <iostream>
+
+#include "glad/glad.h"
+
+#include "render/GlState.h"
+
+//-----------------------------------------------------------------------------
+StreamingBuffer::StreamingBuffer()
+{
+}
+
+//-----------------------------------------------------------------------------
+StreamingBuffer::~StreamingBuffer()
+{
+}
+
+//-----------------------------------------------------------------------------
+bool StreamingBuffer::Initialize(std::uint32_t bytesPerFrame, std::uint32_t alignment)
+{
+	Shutdown();
+
+	if (alignment == 0) {
+		alignment = 1;
+	}
+	mRegionSize = (bytesPerFrame + alignment - 1) / alignment * alignment;
+	GLsizeiptr totalSize = static_cast<GLsizeiptr>(mRegionSize) * FRAME_COUNT;
+
+	// GL_COPY_WRITE_BUFFER 는 그리기와 상관없는 바인딩이라 만들 때만 잠깐 쓴다.
+	glGenBuffers(1, &mBuffer);
+	GlState::BindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+	if (GLAD_GL_VERSION_4_4) {
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_COPY_WRITE_BUFFER, totalSize, nullptr, flags);
+		mMapped = static_cast<std::uint8_t*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, totalSize, flags));
+	}
+	if (mMapped == nullptr) {
+		// persistent 맵핑이 없으면 사본에 쓰고 Commit 마다 glBufferSubData 로 올린다.
+		if (GLAD_GL_VERSION_4_4) {
+			GlState::ForgetBuffer(mBuffer);
+			glDeleteBuffers(1, &mBuffer);
+			glGenBuffers(1, &mBuffer);
+			GlState::BindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+		}
+		glBufferData(GL_COPY_WRITE_BUFFER, totalSize, nullptr, GL_STREAM_DRAW);
+		mStaging.assign(static_cast<std::size_t>(totalSize), 0);
+	}
+
+	mRegion = 0;
+	mHead = 0;
+	mWaitCount = 0;
+	mOverflowCount = 0;
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+void StreamingBuffer::Shutdown()
+{
+	for (void*& fence : mFences) {
+		if (fence != nullptr) {
+			glDeleteSync(static_cast<GLsync>(fence));
+			fence = nullptr;
+		}
+	}
+	if (mBuffer != 0) {
+		if (mMapped != nullptr) {
+			GlState::BindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+			glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+			mMapped = nullptr;
+		}
+		GlState::ForgetBuffer(mBuffer);
+		glDeleteBuffers(1, &mBuffer);
+		mBuffer = 0;
+	}
+	mStaging.clear();
+	mStaging.shrink_to_fit();
+}
+
+//-----------------------------------------------------------------------------
+void StreamingBuffer::BeginFrame()
+{
+	if (mBuffer == 0) {
+		return;
+	}
+
+	mRegion = (mRegion + 1) % FRAME_COUNT;
+	mHead = 0;
+
+	// 보통은 FRAME_COUNT 프레임 전에 끝났으므로 바로 통과한다.
+	GLsync fence = static_cast<GLsync>(mFences[mRegion]);
+	if (fence != nullptr) {
+		GLenum result = glClientWaitSync(fence, 0, 0);
+		if (result == GL_TIMEOUT_EXPIRED) {
+			++mWaitCount;
+			do {
+				result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+			} while (result == GL_TIMEOUT_EXPIRED);
+		}
+		glDeleteSync(fence);
+		mFences[mRegion] = nullptr;
+	}
+}
+
+//-----------------------------------------------------------------------------
+void StreamingBuffer::EndFrame()
+{
+	if (mBuffer == 0 || mHead == 0) {
+		return;
+	}
+	mFences[mRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+//-----------------------------------------------------------------------------
+StreamingBuffer::Allocation StreamingBuffer::Allocate(std::uint32_t size, std::uint32_t alignment)
+{
+	if (mBuffer == 0 || size == 0) {
+		return Allocation{};
+	}
+	if (alignment == 0) {
+		alignment = 1;
+	}
+
+	// 정렬은 구역 안이 아니라 버퍼 처음 기준으로 맞춘다. (stride 처럼 구역 크기의 약수가 아닐 수 있다)
+	std::uint32_t regionBase = static_cast<std::uint32_t>(mRegion) * mRegionSize;
+	std::uint32_t offset = (regionBase + mHead + alignment - 1) / alignment * alignment;
+	if (offset + size > regionBase + mRegionSize) {
+		if (mOverflowCount++ == 0) {
+			std::cout << "[warning] streaming buffer is full (" << mRegionSize << " bytes per frame)" << std::endl;
+		}
+		return Allocation{};
+	}
+
+	Allocation allocation{};
+	allocation.offset = offset;
+	allocation.size = size;
+	allocation.data = (mMapped != nullptr) ? mMapped + offset : mStaging.data() + offset;
+	mHead = offset + size - regionBase;
+	return allocation;
+}
+
+//-----------------------------------------------------------------------------
+void StreamingBuffer::Commit(const Allocation& allocation)
+{
+	if (mMapped != nullptr || !allocation.IsValid()) {
+		return;
+	}
+	GlState::BindBuffer(GL_COPY_WRITE_BUFFER, mBuffer);
+	glBufferSubData(GL_COPY_WRITE_BUFFER, allocation.offset, allocation.size, allocation.data);
+}
+
+//-----------------------------------------------------------------------------
+StreamingBuffer::Allocation StreamingBuffer::Push(const void* data, std::uint32_t size, std::uint32_t alignment)
+{
+	Allocation allocation = Allocate(size, alignment);
+	if (allocation.IsValid()) {
+		std::memcpy(allocation.data, data, size);
+		Commit(allocation);
+	}
+	return allocation;
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// 매 프레임 CPU 가 새로 채우는 데이터(디버그 선, 파티클, UI, 유니폼)를 담는 링 버퍼.
+// 버퍼 하나를 프레임 수만큼 구역으로 나누고, 프레임마다 한 구역 안에서 앞에서부터 잘라 쓴다.
+// GL 4.4 이상이면 glBufferStorage(persistent + coherent)로 한 번만 맵핑해 두고 GPU 가 보는 메모리에 바로 쓴다.
+// 구역을 다시 쓰기 전에 그 구역을 쓴 프레임의 펜스를 확인하므로 orphaning 이나 드라이버의 암묵적 동기화가 없다.
+// GL 4.4 가 없으면 CPU 쪽 사본에 쓰고 Commit 때 glBufferSubData 로 올린다.
+class StreamingBuffer
+{
+public:
+	static constexpr int FRAME_COUNT = 3;
+
+	// 이번 프레임 구역 안에서 받은 자리. offset 은 버퍼 처음부터의 바이트 위치.
+	// data 에 size 바이트를 쓴 뒤 Commit 한다.
+	struct Allocation
+	{
+		std::uint32_t offset{};
+		std::uint32_t size{};
+		std::uint8_t* data{};
+
+		bool IsValid() const { return size != 0; }
+	};
+
+	StreamingBuffer();
+	~StreamingBuffer();
+
+	StreamingBuffer(const StreamingBuffer&) = delete;
+	StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+	// GL 컨텍스트를 가진 스레드에서 호출한다. bytesPerFrame 은 한 프레임에 쓸 최대 크기.
+	// alignment 는 구역 시작 위치의 정렬. (유니폼이면 GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT)
+	bool Initialize(std::uint32_t bytesPerFrame, std::uint32_t alignment = 256);
+	void Shutdown();
+
+	// 이번 프레임이 쓸 구역으로 넘어간다. 그 구역을 쓴 프레임을 GPU 가 아직 끝내지 않았으면 기다린다.
+	void BeginFrame();
+	// 이번 프레임의 그리기 명령을 모두 넣은 뒤 호출한다. (구역에 펜스를 건다)
+	void EndFrame();
+
+	// 이번 프레임 구역에서 size 바이트를 받는다. offset 은 alignment 의 배수다. (2의 거듭제곱이 아니어도 된다)
+	// 버텍스 버퍼로 쓸 때 alignment 를 stride 로 주면 offset / stride 를 base vertex 로 쓸 수 있다.
+	// 구역이 꽉 찼으면 무효 자리.
+	Allocation Allocate(std::uint32_t size, std::uint32_t alignment = 4);
+	// data 에 쓴 내용을 GPU 에 보이게 한다. (coherent 맵핑이면 할 일이 없다)
+	void Commit(const Allocation& allocation);
+	// Allocate + memcpy + Commit.
+	Allocation Push(const void* data, std::uint32_t size, std::uint32_t alignment = 4);
+
+	unsigned int GetBuffer() const { return mBuffer; }
+	bool IsInitialized() const { return mBuffer != 0; }
+	bool IsPersistent() const { return mMapped != nullptr; }
+	// 한 프레임 구역의 크기와 이번 프레임에 쓴 바이트 수.
+	std::uint32_t GetFrameSize() const { return mRegionSize; }
+	std::uint32_t GetFrameUsedSize() const { return mHead; }
+	// 이전 프레임의 펜스를 기다려야 했던 횟수와 구역이 모자라서 실패한 Allocate 횟수.
+	std::uint64_t GetWaitCount() const { return mWaitCount; }
+	std::uint64_t GetOverflowCount() const { return mOverflowCount; }
+
+private:
+	unsigned int mBuffer{};
+	std::uint8_t* mMapped{};
+	// persistent 맵핑이 없을 때 쓰는 CPU 쪽 사본. (버퍼 전체 크기)
+	std::vector<std::uint8_t> mStaging{};
+	std::uint32_t mRegionSize{};
+
+	int mRegion{};
+	std::uint32_t mHead{};
+	void* mFences[FRAME_COUNT]{};
+
+	std::uint64_t mWaitCount{};
+	std::uint64_t mOverflowCount{};
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+#include "glm/glm.hpp"
+
+// 링크할 때 프로그램에서 읽어 온 유니폼 정보. (glGetProgramResource*)
+struct UniformInfo
+{
+	std::string name{};
+	unsigned int type{};
+	int location{ -1 };
+	int arraySize{};
+	// 마지막으로 쓴 값을 보관하는 위치. (ShaderProgram 의 shadow 버퍼 안)
+	std::uint32_t shadowOffset{};
+	bool shadowValid{};
+};
+
+// C++ 타입과 GLSL 유니폼 타입의 대응. (glad 를 헤더에 끌어오지 않으려고 값을 직접 적는다)
+template <typename T> struct UniformTraits;
+template <> struct UniformTraits<float>		{ static constexpr unsigned int GLSL_TYPE = 0x1406; };	// GL_FLOAT
+template <> struct UniformTraits<int>		{ static constexpr unsigned int GLSL_TYPE = 0x1404; };	// GL_INT
+template <> struct UniformTraits<glm::vec2>	{ static constexpr unsigned int GLSL_TYPE = 0x8B50; };	// GL_FLOAT_VEC2
+template <> struct UniformTraits<glm::vec3>	{ static constexpr unsigned int GLSL_TYPE = 0x8B51; };	// GL_FLOAT_VEC3
+template <> struct UniformTraits<glm::vec4>	{ static constexpr unsigned int GLSL_TYPE = 0x8B52; };	// GL_FLOAT_VEC4
+template <> struct UniformTraits<glm::mat3>	{ static constexpr unsigned int GLSL_TYPE = 0x8B5B; };	// GL_FLOAT_MAT3
+template <> struct UniformTraits<glm::mat4>	{ static constexpr unsigned int GLSL_TYPE = 0x8B5C; };	// GL_FLOAT_MAT4
+
+// 타입이 정해진 유니폼 핸들. ShaderProgram::GetUniform<T>("이름") 으로 한 번 얻어 두고 매 프레임 쓴다.
+// 셰이더에 없는(또는 최적화로 빠진) 유니폼이면 무효 핸들이고, 무효 핸들에 쓰는 것은 무시된다.
+template <typename T>
+struct UniformHandle
+{
+	int index{ -1 };
+
+	bool IsValid() const { return index >= 0; }
+};
@@ -0,0 +1,117 @@
+#pragma once
+#include <cstddef>
+#include <cstring>
+
+#include "glm/glm.hpp"
+
+// 셰이더의 uniform block 과 같은 배치의 C++ 구조체들. (셰이더 쪽은 layout(std140))
+// GLSL 선언도 구조체마다 여기 함께 둔다. 파일 셰이더에는 ShaderCache 가 #version 줄 뒤에 넣어 주므로
+// 블록을 바꿀 때는 이 파일만 고치면 된다.
+// std140 에서 vec3, vec4, 행렬의 열은 16바이트 경계에 놓이고, vec3 바로 뒤의 float 는 남는 4바이트에 들어간다.
+// 배치가 어긋나면 셰이더에서 엉뚱한 값이 보이므로 오프셋을 컴파일할 때 확인한다.
+
+// std140 의 mat3 은 열마다 vec4 만큼 자리를 차지한다.
+struct Std140Mat3
+{
+	glm::vec4 columns[3]{};
+
+	Std140Mat3() = default;
+	Std140Mat3(const glm::mat3& matrix)
+		: columns{ glm::vec4(matrix[0], 0.0f), glm::vec4(matrix[1], 0.0f), glm::vec4(matrix[2], 0.0f) }
+	{
+	}
+};
+
+// layout(std140) uniform PerFrame. 프레임마다 한 번 올린다.
+struct PerFrameConstants
+{
+	glm::mat4 view{ 1.0f };
+	glm::mat4 projection{ 1.0f };
+	glm::mat4 viewProjection{ 1.0f };
+	glm::vec3 cameraWorldPosition{};
+	float time{};
+	glm::vec3 lightDirection{ 0.0f, -1.0f, 0.0f };
+	float ambientIntensity{};
+	glm::vec3 lightColor{ 1.0f };
+	float padding0{};
+
+	static constexpr const char* GLSL = R"(layout(std140) uniform PerFrame
+{
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+	vec3 cameraWorldPosition;
+	float time;
+	vec3 lightDirection;
+	float ambientIntensity;
+	vec3 lightColor;
+};
+)";
+};
+
+// layout(std140) uniform PerObject. 그리기마다 링 버퍼에서 자리를 받아 올린다.
+struct PerObjectConstants
+{
+	glm::mat4 modelMatrix{ 1.0f };
+	glm::mat4 mvp{ 1.0f };
+	Std140Mat3 normalMatrix{};
+	glm::vec3 customColor{ 1.0f };
+	float padding0{};
+
+	static constexpr const char* GLSL = R"(layout(std140) uniform PerObject
+{
+	mat4 modelMatrix;
+	mat4 mvp;
+	mat3 normalMatrix;
+	vec3 customColor;
+};
+)";
+};
+
+static_assert(sizeof(Std140Mat3) == 48, "std140 mat3 is three vec4 columns");
+
+static_assert(offsetof(PerFrameConstants, view) == 0, "PerFrame layout");
+static_assert(offsetof(PerFrameConstants, projection) == 64, "PerFrame layout");
+static_assert(offsetof(PerFrameConstants, viewProjection) == 128, "PerFrame layout");
+static_assert(offsetof(PerFrameConstants, cameraWorldPosition) == 192, "PerFrame layout");
+static_assert(offsetof(PerFrameConstants, time) == 204, "PerFrame layout");
+static_assert(offsetof(PerFrameConstants, lightDirection) == 208, "PerFrame layout");
+static_assert(offsetof(PerFrameConstants, ambientIntensity) == 220, "PerFrame layout");
+static_assert(offsetof(PerFrameConstants, lightColor) == 224, "PerFrame layout");
+static_assert(sizeof(PerFrameConstants) == 240, "PerFrame size must be a multiple of 16");
+
+static_assert(offsetof(PerObjectConstants, modelMatrix) == 0, "PerObject layout");
+static_assert(offsetof(PerObjectConstants, mvp) == 64, "PerObject layout");
+static_assert(offsetof(PerObjectConstants, normalMatrix) == 128, "PerObject layout");
+static_assert(offsetof(PerObjectConstants, customColor) == 176, "PerObject layout");
+static_assert(sizeof(PerObjectConstants) == 192, "PerObject size must be a multiple of 16");
+
+// 블록마다 고정된 바인딩 위치. 셰이더가 링크될 때 이름으로 찾아서 glUniformBlockBinding 한다.
+// (#version 330 셰이더라 layout(binding = N) 을 쓸 수 없다)
+namespace UniformBlockBinding
+{
+	constexpr unsigned int PER_FRAME = 0;
+	constexpr unsigned int PER_OBJECT = 1;
+
+	struct BlockInfo
+	{
+		const char* name;
+		unsigned int binding;
+		std::size_t size;
+	};
+
+	// 블록 이름으로 바인딩 위치와 C++ 구조체 크기를 찾는다. 모르는 블록이면 nullptr.
+	inline const BlockInfo* Find(const char* name)
+	{
+		static const BlockInfo BLOCKS[] = {
+			{ "PerFrame", PER_FRAME, sizeof(PerFrameConstants) },
+			{ "PerObject", PER_OBJECT, sizeof(PerObjectConstants) },
+		};
+		for (const BlockInfo& block : BLOCKS) {
+			if (std::strcmp(block.name, name) == 0) {
+				return &block;
+			}
+		}
+		return nullptr;
+	}
+}
@@ -0,0 +1,53 @@
+#include "render/UniformBuffer.h"
+
+#include <iostream>
+
+#include "glad/glad.h"
+
+#include "render/GlState.h"
+
+//-----------------------------------------------------------------------------
+UniformBuffer::UniformBuffer()
+{
+}
+
+//-----------------------------------------------------------------------------
+UniformBuffer::~UniformBuffer()
+{
+}
+
+//-----------------------------------------------------------------------------
+void UniformBuffer::Create(std::uint32_t size)
+{
+	Destroy();
+	glGenBuffers(1, &mBuffer);
+	GlState::BindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+	glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+	mSize = size;
+}
+
+//-----------------------------------------------------------------------------
+void UniformBuffer::Destroy()
+{
+	if (mBuffer != 0) {
+		GlState::ForgetBuffer(mBuffer);
+		glDeleteBuffers(1, &mBuffer);
+		mBuffer = 0;
+	}
+	mSize = 0;
+}
+
+//-----------------------------------------------------------------------------
+void UniformBuffer::Upload(unsigned int binding, const void* data, std::uint32_t size)
+{
+	if (mBuffer == 0 || size > mSize) {
+		std::cout << "[warning] uniform buffer upload of " << size << " bytes does not fit " << mSize << std::endl;
+		return;
+	}
+	// 이전 프레임이 아직 읽고 있을 수 있다. 같은 저장 공간에 바로 SubData 를 하면 그 프레임이 끝날 때까지 기다리므로,
+	// 먼저 nullptr 로 다시 잡아서(orphan) 드라이버가 새 저장 공간을 주게 한 뒤 쓴다.
+	GlState::BindBuffer(GL_UNIFORM_BUFFER, mBuffer);
+	glBufferData(GL_UNIFORM_BUFFER, mSize, nullptr, GL_DYNAMIC_DRAW);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, size, data);
+	GlState::BindBufferBase(GL_UNIFORM_BUFFER, binding, mBuffer);
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+
+// 통째로 한 번에 바꾸는 작은 유니폼 버퍼. (PerFrameConstants 처럼 프레임마다 한 번 올리는 값)
+// GL 컨텍스트를 가진 스레드에서만 쓴다.
+class UniformBuffer
+{
+public:
+	UniformBuffer();
+	~UniformBuffer();
+
+	UniformBuffer(const UniformBuffer&) = delete;
+	UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+	void Create(std::uint32_t size);
+	void Destroy();
+
+	// 저장 공간을 새로 받아(orphan) 값을 쓰고 binding 위치에 연결한다.
+	void Upload(unsigned int binding, const void* data, std::uint32_t size);
+	template <typename T>
+	void Upload(unsigned int binding, const T& value)
+	{
+		Upload(binding, &value, static_cast<std::uint32_t>(sizeof(T)));
+	}
+
+	bool IsValid() const { return mBuffer != 0; }
+	unsigned int GetBuffer() const { return mBuffer; }
+
+private:
+	unsigned int mBuffer{};
+	std::uint32_t mSize{};
+};
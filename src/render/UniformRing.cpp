@@ -0,0 +1,74 @@
+#include "render/UniformRing.h"
+
+#include "glad/glad.h"
+
+#include "render/GlState.h"
+
+//-----------------------------------------------------------------------------
+UniformRing::UniformRing()
+{
+}
+
+//-----------------------------------------------------------------------------
+UniformRing::~UniformRing()
+{
+}
+
+//-----------------------------------------------------------------------------
+bool UniformRing::Initialize(std::uint32_t bytesPerFrame)
+{
+	// glBindBufferRange 의 offset 은 이 값의 배수여야 한다. (보통 256)
+	GLint alignment = 256;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	mAlignment = static_cast<std::uint32_t>(alignment > 0 ? alignment : 256);
+	return mStream.Initialize(bytesPerFrame, mAlignment);
+}
+
+//-----------------------------------------------------------------------------
+void UniformRing::Shutdown()
+{
+	mStream.Shutdown();
+}
+
+//-----------------------------------------------------------------------------
+void UniformRing::BeginFrame()
+{
+	mStream.BeginFrame();
+}
+
+//-----------------------------------------------------------------------------
+void UniformRing::EndFrame()
+{
+	mStream.EndFrame();
+}
+
+//-----------------------------------------------------------------------------
+UniformRing::Allocation UniformRing::Push(const void* data, std::uint32_t size)
+{
+	StreamingBuffer::Allocation streamed = mStream.Push(data, size, mAlignment);
+	Allocation allocation{};
+	if (streamed.IsValid()) {
+		allocation.offset = streamed.offset;
+		allocation.size = streamed.size;
+	}
+	return allocation;
+}
+
+//-----------------------------------------------------------------------------
+std::uint32_t UniformRing::GetCapacity(std::uint32_t size) const
+{
+	if (size == 0) {
+		return 0;
+	}
+	std::uint32_t stride = (size + mAlignment - 1) / mAlignment * mAlignment;
+	return mStream.GetFrameSize() / stride;
+}
+
+//-----------------------------------------------------------------------------
+void UniformRing::BindRange(unsigned int binding, const Allocation& allocation) const
+{
+	if (!allocation.IsValid()) {
+		return;
+	}
+	GlState::BindBufferRange(GL_UNIFORM_BUFFER, binding, mStream.GetBuffer(), allocation.offset, allocation.size);
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+
+#include "render/StreamingBuffer.h"
+
+// 그리기마다 바뀌는 유니폼(PerObjectConstants 등)을 담는 링 버퍼.
+// 그리기마다 glBufferSubData + 유니폼 여러 개를 부르는 대신 memcpy 한 번과 glBindBufferRange 한 번이면 된다.
+// 프레임별 구역과 펜스, persistent 맵핑은 StreamingBuffer 가 맡고, 여기서는 유니폼 오프셋 정렬만 맞춘다.
+class UniformRing
+{
+public:
+	static constexpr int FRAME_COUNT = StreamingBuffer::FRAME_COUNT;
+
+	// 링 안에서 받은 자리. 그리기 전에 BindRange 로 연결한다.
+	struct Allocation
+	{
+		std::uint32_t offset{};
+		std::uint32_t size{};
+
+		bool IsValid() const { return size != 0; }
+	};
+
+	UniformRing();
+	~UniformRing();
+
+	UniformRing(const UniformRing&) = delete;
+	UniformRing& operator=(const UniformRing&) = delete;
+
+	// GL 컨텍스트를 가진 스레드에서 호출한다. bytesPerFrame 은 한 프레임에 올릴 최대 크기.
+	bool Initialize(std::uint32_t bytesPerFrame);
+	void Shutdown();
+
+	// 이번 프레임이 쓸 구역으로 넘어간다. 그 구역을 쓴 프레임을 GPU 가 아직 끝내지 않았으면 기다린다.
+	void BeginFrame();
+	// 이번 프레임의 그리기 명령을 모두 넣은 뒤 호출한다. (구역에 펜스를 건다)
+	void EndFrame();
+
+	// 데이터를 링에 복사하고 자리를 돌려준다. 이번 프레임 구역이 꽉 찼으면 무효 자리.
+	Allocation Push(const void* data, std::uint32_t size);
+	template <typename T>
+	Allocation Push(const T& value)
+	{
+		return Push(&value, static_cast<std::uint32_t>(sizeof(T)));
+	}
+	void BindRange(unsigned int binding, const Allocation& allocation) const;
+
+	bool IsInitialized() const { return mStream.IsInitialized(); }
+	bool IsPersistent() const { return mStream.IsPersistent(); }
+	// size 바이트짜리 Push 를 한 프레임에 몇 번 할 수 있는지. (오프셋 정렬 포함)
+	std::uint32_t GetCapacity(std::uint32_t size) const;
+	// 이전 프레임의 펜스를 기다려야 했던 횟수와 구역이 모자라서 버린 Push 횟수.
+	std::uint64_t GetWaitCount() const { return mStream.GetWaitCount(); }
+	std::uint64_t GetOverflowCount() const { return mStream.GetOverflowCount(); }
+
+private:
+	StreamingBuffer mStream{};
+	std::uint32_t mAlignment{ 256 };
+};
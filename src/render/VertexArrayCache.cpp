@@ -0,0 +1,131 @@
+#include "render/VertexArrayCache.h"
+
+#include "glad/glad.h"
+
+#include "render/GlState.h"
+
+//-----------------------------------------------------------------------------
+VertexArrayCache::VertexArrayCache()
+{
+}
+
+//-----------------------------------------------------------------------------
+VertexArrayCache::~VertexArrayCache()
+{
+}
+
+//-----------------------------------------------------------------------------
+VertexArrayCache::Entry& VertexArrayCache::GetOrCreate(const VertexFormat& format)
+{
+	// 포맷은 몇 개 안 되므로 차례로 비교한다.
+	for (Entry& entry : mEntries) {
+		if (entry.format == format) {
+			return entry;
+		}
+	}
+
+	Entry entry{};
+	entry.format = format;
+	if (GLAD_GL_VERSION_4_5) {
+		glCreateVertexArrays(1, &entry.vertexArray);
+		for (int i = 0; i < format.attributeCount; ++i) {
+			const VertexAttribute& attribute = format.attributes[i];
+			glEnableVertexArrayAttrib(entry.vertexArray, attribute.location);
+			glVertexArrayAttribFormat(entry.vertexArray, attribute.location, attribute.componentCount, attribute.type,
+				attribute.normalized ? GL_TRUE : GL_FALSE, attribute.offset);
+			glVertexArrayAttribBinding(entry.vertexArray, attribute.location, 0);
+		}
+	}
+	else {
+		glGenVertexArrays(1, &entry.vertexArray);
+	}
+	mEntries.push_back(entry);
+	return mEntries.back();
+}
+
+//-----------------------------------------------------------------------------
+void VertexArrayCache::Bind(const VertexFormat& format, unsigned int vertexBuffer, unsigned int indexBuffer)
+{
+	Entry& entry = GetOrCreate(format);
+	GlState::BindVertexArray(entry.vertexArray);
+	if (entry.vertexBuffer == vertexBuffer && entry.indexBuffer == indexBuffer) {
+		return;
+	}
+
+	if (GLAD_GL_VERSION_4_5) {
+		if (entry.vertexBuffer != vertexBuffer) {
+			glVertexArrayVertexBuffer(entry.vertexArray, 0, vertexBuffer, 0, static_cast<GLsizei>(format.stride));
+		}
+		if (entry.indexBuffer != indexBuffer) {
+			glVertexArrayElementBuffer(entry.vertexArray, indexBuffer);
+		}
+	}
+	else {
+		// 속성 포인터는 바인딩된 GL_ARRAY_BUFFER 를 기억하므로 버퍼가 바뀔 때마다 다시 설정한다.
+		GlState::BindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+		for (int i = 0; i < format.attributeCount; ++i) {
+			const VertexAttribute& attribute = format.attributes[i];
+			glEnableVertexAttribArray(attribute.location);
+			glVertexAttribPointer(attribute.location, attribute.componentCount, attribute.type,
+				attribute.normalized ? GL_TRUE : GL_FALSE, static_cast<GLsizei>(format.stride),
+				reinterpret_cast<const void*>(static_cast<std::uintptr_t>(attribute.offset)));
+		}
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+	}
+	entry.vertexBuffer = vertexBuffer;
+	entry.indexBuffer = indexBuffer;
+}
+
+//-----------------------------------------------------------------------------
+void VertexArrayCache::Clear()
+{
+	for (Entry& entry : mEntries) {
+		glDeleteVertexArrays(1, &entry.vertexArray);
+	}
+	mEntries.clear();
+}
+
+//-----------------------------------------------------------------------------
+void VertexArrayCache::DetachBuffer(unsigned int buffer)
+{
+	if (buffer == 0) {
+		return;
+	}
+	for (Entry& entry : mEntries) {
+		if (entry.vertexBuffer == buffer) {
+			entry.vertexBuffer = 0;
+		}
+		if (entry.indexBuffer == buffer) {
+			entry.indexBuffer = 0;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+void VertexArrayCache::DeleteBuffer(unsigned int& buffer)
+{
+	if (buffer == 0) {
+		return;
+	}
+	DetachBuffer(buffer);
+	GlState::ForgetBuffer(buffer);
+	glDeleteBuffers(1, &buffer);
+	buffer = 0;
+}
+
+//-----------------------------------------------------------------------------
+unsigned int VertexArrayCache::CreateStaticBuffer(const void* data, std::size_t size)
+{
+	unsigned int buffer{};
+	if (GLAD_GL_VERSION_4_5) {
+		glCreateBuffers(1, &buffer);
+		glNamedBufferStorage(buffer, static_cast<GLsizeiptr>(size), data, 0);
+	}
+	else {
+		// 버퍼 종류는 처음 바인딩할 때 정해지지 않으므로 인덱스 버퍼도 GL_ARRAY_BUFFER 로 올려도 된다.
+		glGenBuffers(1, &buffer);
+		GlState::BindBuffer(GL_ARRAY_BUFFER, buffer);
+		glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(size), data, GL_STATIC_DRAW);
+	}
+	return buffer;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "common/VertexLayout.h"
+
+// 버텍스 포맷마다 VAO 를 하나만 만들고 같은 포맷의 메시들이 나눠 쓴다.
+// 속성 포맷은 만들 때 한 번만 설정하고(GL 4.5 DSA: glVertexArrayAttribFormat),
+// 메시를 그릴 때는 binding 0 의 버텍스 버퍼와 인덱스 버퍼만 바꾼다. (glVertexArrayVertexBuffer)
+// GL 4.5 가 없으면(macOS) 바꿀 때마다 glVertexAttribPointer 로 다시 설정한다.
+class VertexArrayCache
+{
+public:
+	VertexArrayCache();
+	~VertexArrayCache();
+
+	VertexArrayCache(const VertexArrayCache&) = delete;
+	VertexArrayCache& operator=(const VertexArrayCache&) = delete;
+
+	// 포맷의 VAO 를 바인딩하고 메시 버퍼를 붙인다. 이미 붙어 있는 버퍼면 다시 붙이지 않는다.
+	void Bind(const VertexFormat& format, unsigned int vertexBuffer, unsigned int indexBuffer);
+	template <typename T>
+	void Bind(unsigned int vertexBuffer, unsigned int indexBuffer)
+	{
+		Bind(VertexLayout<T>::GetFormat(), vertexBuffer, indexBuffer);
+	}
+
+	// GL 컨텍스트가 없어지기 전에 호출한다.
+	void Clear();
+	int GetVertexArrayCount() const { return static_cast<int>(mEntries.size()); }
+
+	// 내용이 바뀌지 않는 버퍼를 만들어 data 를 올린다. (버텍스/인덱스 공용)
+	static unsigned int CreateStaticBuffer(const void* data, std::size_t size);
+	// 버퍼를 지운다. VAO 에 붙어 있던 버퍼면 떼어 내서 같은 이름으로 새로 만든 버퍼를 헷갈리지 않게 한다.
+	void DeleteBuffer(unsigned int& buffer);
+	// 다른 곳에서 지울 버퍼를 VAO 가 기억하지 않게 한다. (StreamingBuffer 등)
+	void DetachBuffer(unsigned int buffer);
+
+private:
+	struct Entry
+	{
+		VertexFormat format{};
+		unsigned int vertexArray{};
+		unsigned int vertexBuffer{};
+		unsigned int indexBuffer{};
+	};
+
+	Entry& GetOrCreate(const VertexFormat& format);
+
+private:
+	std::vector<Entry> mEntries{};
+};